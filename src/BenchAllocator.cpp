@@ -0,0 +1,57 @@
+#include <cstddef>
+#include <memory_resource>
+
+#include "benchmark.h"
+#include "containerAdaptor.h"
+#include "map.h"
+#include "vector.h"
+
+using namespace s21;
+
+//  One "request" fills a Vector, a Map and a Queue and throws them away.
+//  With the default allocator every growth step and every tree node is a
+//  heap call; with a monotonic buffer reset between requests it is a pointer
+//  bump inside one reused buffer
+
+const int RequestItems{256};
+
+template <typename VectorType, typename MapType, typename QueueType,
+          typename... Resource>
+long ServeRequest(Resource *...resource) {
+  VectorType vector(resource...);
+  MapType map(resource...);
+  QueueType queue(resource...);
+  for (int i{0}; i < RequestItems; i++) {
+    vector.push_back(i);
+    map.insert(i * 31 % RequestItems, i);
+    queue.push(i);
+  }
+  return vector.size() + map.size() + queue.size();
+}
+
+int main() {
+  const size_t requests{100000};
+  long total{0};
+
+  bench::Report("default allocator", requests, bench::MeasureMs([&] {
+                  for (size_t i{0}; i < requests; i++) {
+                    total += ServeRequest<Vector<int>, Map<int, int>,
+                                          Queue<int>>();
+                  }
+                }));
+
+  static std::byte buffer[256 * 1024];
+  bench::Report("pmr::monotonic_buffer_resource", requests,
+                bench::MeasureMs([&] {
+                  std::pmr::monotonic_buffer_resource resource(
+                      buffer, sizeof(buffer));
+                  for (size_t i{0}; i < requests; i++) {
+                    total += ServeRequest<pmr::Vector<int>, pmr::Map<int, int>,
+                                          pmr::Queue<int>>(&resource);
+                    resource.release();
+                  }
+                }));
+
+  bench::DoNotOptimize(total);
+  return 0;
+}
@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "benchmark.h"
+#include "concurrentQueue.h"
+
+using namespace s21;
+
+typedef std::chrono::steady_clock Clock;
+
+//  Throughput: one producer streams N items to one consumer, single items
+//  and batches of 64
+
+template <size_t Batch>
+void SpscThroughput(const char *name, size_t count) {
+  auto queue = std::make_unique<SpscQueue<long, 4096>>();
+  double ms = bench::MeasureMs([&] {
+    std::thread producer([&] {
+      long values[Batch];
+      for (size_t i{0}; i < count;) {
+        size_t size = std::min(Batch, count - i);
+        for (size_t j{0}; j < size; j++) values[j] = static_cast<long>(i + j);
+        size_t pushed = Batch == 1 ? queue->try_push(values[0])
+                                   : queue->try_push_n(values, size);
+        if (pushed == 0) std::this_thread::yield();
+        i += pushed;
+      }
+    });
+    long values[Batch], sum{0};
+    for (size_t i{0}; i < count;) {
+      size_t popped = Batch == 1 ? queue->try_pop(values[0])
+                                 : queue->try_pop_n(values, Batch);
+      for (size_t j{0}; j < popped; j++) sum += values[j];
+      if (popped == 0) std::this_thread::yield();
+      i += popped;
+    }
+    producer.join();
+    bench::DoNotOptimize(sum);
+  });
+  bench::Report(name, count, ms);
+  std::printf("%-40s %10.2f Mops/sec\n", "", count / ms / 1000);
+}
+
+//  Latency: a token bounces between two threads through two queues, every
+//  round trip is timed and the percentiles are printed
+
+void SpscPingPong(size_t rounds) {
+  auto ping = std::make_unique<SpscQueue<size_t, 64>>();
+  auto pong = std::make_unique<SpscQueue<size_t, 64>>();
+  std::thread echo([&] {
+    size_t token{0};
+    SpinBackoff backoff;
+    for (size_t i{0}; i < rounds; i++) {
+      while (!ping->try_pop(token)) backoff.Pause();
+      backoff.Reset();
+      pong->push(token);
+    }
+  });
+  std::vector<double> latency(rounds);
+  size_t token{0};
+  SpinBackoff backoff;
+  for (size_t i{0}; i < rounds; i++) {
+    auto start = Clock::now();
+    ping->push(i);
+    while (!pong->try_pop(token)) backoff.Pause();
+    backoff.Reset();
+    latency[i] = std::chrono::duration<double, std::nano>(Clock::now() - start)
+                     .count();
+  }
+  echo.join();
+  std::sort(latency.begin(), latency.end());
+  std::printf("SpscQueue ping-pong %zu round trips, ns: p50 %.0f p90 %.0f "
+              "p99 %.0f p99.9 %.0f max %.0f\n",
+              rounds, latency[rounds / 2], latency[rounds * 9 / 10],
+              latency[rounds * 99 / 100], latency[rounds * 999 / 1000],
+              latency.back());
+}
+
+//  Scaling: P producers and P consumers share one MpmcQueue and move N
+//  items in total through blocking push/pop, P = 1, 2, 4 ... up to the
+//  number of hardware threads (at least 4)
+
+void MpmcScaling(size_t count) {
+  size_t maxThreads = std::max(4u, std::thread::hardware_concurrency());
+  for (size_t threads{1}; threads <= maxThreads; threads *= 2) {
+    auto queue = std::make_unique<MpmcQueue<long, 4096>>();
+    size_t share = count / threads;
+    double ms = bench::MeasureMs([&] {
+      std::vector<std::thread> workers;
+      for (size_t t{0}; t < threads; t++) {
+        workers.emplace_back([&] {
+          for (size_t i{0}; i < share; i++) queue->push(static_cast<long>(i));
+        });
+        workers.emplace_back([&] {
+          long value{0}, sum{0};
+          for (size_t i{0}; i < share; i++) {
+            queue->pop(value);
+            sum += value;
+          }
+          bench::DoNotOptimize(sum);
+        });
+      }
+      for (auto &worker : workers) worker.join();
+    });
+    std::printf("MpmcQueue %2zu producers x %2zu consumers  %10zu items "
+                "%10.2f ms %8.2f Mops/sec\n",
+                threads, threads, share * threads, ms,
+                share * threads / ms / 1000);
+  }
+}
+
+int main() {
+  SpscThroughput<1>("SpscQueue try_push/try_pop", 10000000);
+  SpscThroughput<64>("SpscQueue try_push_n/try_pop_n x64", 10000000);
+  SpscPingPong(100000);
+  MpmcScaling(4000000);
+  return 0;
+}
@@ -0,0 +1,193 @@
+#include <cstdio>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "benchmark.h"
+#include "intrusiveList.h"
+#include "list.h"
+#include "poolAllocator.h"
+#include "unrolledList.h"
+
+using namespace s21;
+
+//  Build, scan and clear a list of N ints with every node from the heap
+//  versus carved out of PoolAllocator chunks
+
+template <typename ListType>
+void BuildScanClear(const char *name, size_t count) {
+  ListType list;
+  long sum{0};
+  char title[64];
+  std::snprintf(title, sizeof(title), "%s push_back", name);
+  bench::Report(title, count, bench::MeasureMs([&] {
+                  for (size_t i{0}; i < count; i++) {
+                    list.push_back(static_cast<int>(i));
+                  }
+                }));
+  std::snprintf(title, sizeof(title), "%s scan", name);
+  bench::Report(title, count, bench::MeasureMs([&] {
+                  for (auto iter = list.begin(); iter != list.end(); ++iter) {
+                    sum += *iter;
+                  }
+                }));
+  std::snprintf(title, sizeof(title), "%s clear", name);
+  bench::Report(title, count, bench::MeasureMs([&] { list.clear(); }));
+  bench::DoNotOptimize(sum);
+}
+
+//  sort, merge, splice, reverse and unique of N-node lists: all of them
+//  relink nodes and never allocate
+
+template <typename ListType>
+void Algorithms(const char *name, size_t count) {
+  std::mt19937 generator(21);
+  ListType list, other;
+  for (size_t i{0}; i < count; i++) {
+    list.push_back(static_cast<int>(generator() % count));
+  }
+  char title[64];
+  std::snprintf(title, sizeof(title), "%s sort", name);
+  bench::Report(title, count, bench::MeasureMs([&] { list.sort(); }));
+  for (size_t i{0}; i < count; i++) {
+    other.push_back(static_cast<int>(i));
+  }
+  std::snprintf(title, sizeof(title), "%s merge", name);
+  bench::Report(title, count, bench::MeasureMs([&] { list.merge(other); }));
+  std::snprintf(title, sizeof(title), "%s reverse", name);
+  bench::Report(title, count * 2, bench::MeasureMs([&] { list.reverse(); }));
+  std::snprintf(title, sizeof(title), "%s unique", name);
+  bench::Report(title, count * 2, bench::MeasureMs([&] { list.unique(); }));
+  other.push_back(0);
+  std::snprintf(title, sizeof(title), "%s splice", name);
+  bench::Report(title, 1, bench::MeasureMs([&] {
+                  other.splice(other.begin(), list);
+                }));
+  bench::DoNotOptimize(other.size());
+}
+
+//  Inserts in the middle of an N-element list, then a scan of the result:
+//  List allocates a node per insert, UnrolledList moves the rest of a node
+//  and splits it when it is full
+
+template <typename ListType>
+void MiddleInsert(const char *name, size_t size, size_t count) {
+  ListType list;
+  for (size_t i{0}; i < size; i++) {
+    list.push_back(static_cast<int>(i));
+  }
+  auto iter = list.begin();
+  for (size_t i{0}; i < size / 2; i++) {
+    ++iter;
+  }
+  long sum{0};
+  char title[64];
+  std::snprintf(title, sizeof(title), "%s middle insert", name);
+  bench::Report(title, count, bench::MeasureMs([&] {
+                  for (size_t i{0}; i < count; i++) {
+                    iter = list.insert(iter, static_cast<int>(i));
+                    ++iter;
+                  }
+                }));
+  std::snprintf(title, sizeof(title), "%s scan after inserts", name);
+  bench::Report(title, size + count, bench::MeasureMs([&] {
+                  for (auto each = list.begin(); each != list.end(); ++each) {
+                    sum += *each;
+                  }
+                }));
+  bench::DoNotOptimize(sum);
+}
+
+//  Scan of a list whose nodes sort() has relinked into random address
+//  order, then compact() and the same scan over nodes in address order
+
+template <typename ListType>
+void ScanScattered(const char *name, size_t count) {
+  std::mt19937 generator(25);
+  ListType list;
+  for (size_t i{0}; i < count; i++) {
+    list.push_back(static_cast<int>(generator() % count));
+  }
+  list.sort();
+  long sum{0};
+  auto scan = [&] {
+    for (auto iter = list.begin(); iter != list.end(); ++iter) {
+      sum += *iter;
+    }
+  };
+  char title[64];
+  std::snprintf(title, sizeof(title), "%s scattered scan", name);
+  bench::Report(title, count, bench::MeasureMs(scan));
+  std::snprintf(title, sizeof(title), "%s compact", name);
+  bench::Report(title, count, bench::MeasureMs([&] { list.compact(); }));
+  std::snprintf(title, sizeof(title), "%s scan after compact", name);
+  bench::Report(title, count, bench::MeasureMs(scan));
+  bench::DoNotOptimize(sum);
+}
+
+//  LRU touch: a random one of N live objects is moved to the back of the
+//  list. s21::List keeps a pointer per node and an iterator per object and
+//  frees and allocates a node on every touch, the IntrusiveList relinks the
+//  hook inside the object
+
+struct Entry {
+  long Key{0};
+  ListHook Hook;
+};
+
+void TouchList(size_t objects, size_t count) {
+  std::mt19937 generator(21);
+  std::vector<Entry> entries(objects);
+  std::vector<List<Entry *>::iterator> where(objects);
+  List<Entry *> list;
+  for (size_t i{0}; i < objects; i++) {
+    list.push_back(&entries[i]);
+    where[i] = --list.end();
+  }
+  bench::Report("s21::List<Entry *> touch", count, bench::MeasureMs([&] {
+                  for (size_t i{0}; i < count; i++) {
+                    size_t touched{generator() % objects};
+                    list.erase(where[touched]);
+                    list.push_back(&entries[touched]);
+                    where[touched] = --list.end();
+                  }
+                }));
+  bench::DoNotOptimize(list.front());
+}
+
+void TouchIntrusiveList(size_t objects, size_t count) {
+  std::mt19937 generator(21);
+  std::vector<Entry> entries(objects);
+  IntrusiveList<Entry, &Entry::Hook> list;
+  for (Entry &entry : entries) {
+    list.push_back(entry);
+  }
+  bench::Report("s21::IntrusiveList touch", count, bench::MeasureMs([&] {
+                  for (size_t i{0}; i < count; i++) {
+                    Entry &touched = entries[generator() % objects];
+                    list.erase(touched);
+                    list.push_back(touched);
+                  }
+                }));
+  bench::DoNotOptimize(list.front());
+}
+
+int main() {
+  const size_t count{10000000};
+  TouchList(100000, count);
+  TouchIntrusiveList(100000, count);
+  BuildScanClear<List<int>>("s21::List", count);
+  BuildScanClear<List<int, PoolAllocator<int>>>("s21::List<PoolAllocator>",
+                                                count);
+  BuildScanClear<std::list<int>>("std::list", count);
+  BuildScanClear<UnrolledList<int>>("s21::UnrolledList", count);
+  MiddleInsert<List<int>>("s21::List", count, count / 10);
+  MiddleInsert<UnrolledList<int>>("s21::UnrolledList", count, count / 10);
+  MiddleInsert<std::list<int>>("std::list", count, count / 10);
+  ScanScattered<List<int>>("s21::List", count / 10);
+  ScanScattered<List<int, PoolAllocator<int>>>("s21::List<PoolAllocator>",
+                                               count / 10);
+  Algorithms<List<int>>("s21::List", count);
+  Algorithms<std::list<int>>("std::list", count);
+  return 0;
+}
@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <map>
+#include <random>
+
+#include "benchmark.h"
+#include "map.h"
+
+using namespace s21;
+
+//  Insert, lookup and erase of N random keys: every operation is O(log N),
+//  so ns/item grows only logarithmically from 100K to 1M keys. A frozen
+//  map finds keys in the cache-line static index instead of the tree
+
+int main() {
+  for (size_t count : {100000, 1000000}) {
+    std::vector<int> keys(count);
+    for (size_t i{0}; i < count; i++) keys[i] = static_cast<int>(i);
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(21));
+
+    Map<int, int> map;
+    std::map<int, int> reference;
+    long sum{0};
+
+    //  merging two maps of N keys, every third key of the source present
+    //  in the target. It runs first, while freed nodes of the other steps
+    //  do not yet scatter the nodes the maps are built from
+
+    Map<int, int> target, source;
+    std::map<int, int> referenceTarget, referenceSource;
+    for (size_t i{0}; i < count; i++) {
+      target.insert(static_cast<int>(i * 2), 0);
+      source.insert(static_cast<int>(i * 3), 0);
+    }
+    for (size_t i{0}; i < count; i++) {
+      referenceTarget.emplace(static_cast<int>(i * 2), 0);
+      referenceSource.emplace(static_cast<int>(i * 3), 0);
+    }
+    bench::Report("s21::Map merge", count, bench::MeasureMs([&] {
+                    target.merge(source);
+                  }));
+    bench::Report("std::map merge", count, bench::MeasureMs([&] {
+                    referenceTarget.merge(referenceSource);
+                  }));
+    sum += target.size() + referenceTarget.size();
+
+    bench::Report("s21::Map insert", count, bench::MeasureMs([&] {
+                    for (int key : keys) map.insert(key, key);
+                  }));
+    bench::Report("std::map insert", count, bench::MeasureMs([&] {
+                    for (int key : keys) reference.emplace(key, key);
+                  }));
+    bench::Report("s21::Map at", count, bench::MeasureMs([&] {
+                    for (int key : keys) sum += map.at(key);
+                  }));
+    bench::Report("std::map at", count, bench::MeasureMs([&] {
+                    for (int key : keys) sum += reference.at(key);
+                  }));
+    bench::Report("s21::Map FindPosition", count, bench::MeasureMs([&] {
+                    for (int key : keys) {
+                      sum += (*map.FindPosition(key).first).second;
+                    }
+                  }));
+    bench::Report("s21::Map Freeze", count,
+                  bench::MeasureMs([&] { map.Freeze(); }));
+    bench::Report("s21::Map frozen FindPosition", count,
+                  bench::MeasureMs([&] {
+                    for (int key : keys) {
+                      sum += (*map.FindPosition(key).first).second;
+                    }
+                  }));
+    bench::Report("s21::Map frozen at", count, bench::MeasureMs([&] {
+                    for (int key : keys) sum += map.at(key);
+                  }));
+    bench::Report("s21::Map erase", count, bench::MeasureMs([&] {
+                    for (int key : keys) map.erase(map.FindPosition(key).first);
+                  }));
+    bench::Report("std::map erase", count, bench::MeasureMs([&] {
+                    for (int key : keys) reference.erase(key);
+                  }));
+
+    //  loading all keys as one batch: sort, then a linear merge
+
+    std::vector<std::pair<int, int>> batch;
+    for (int key : keys) batch.emplace_back(key, key);
+    bench::Report("s21::Map range load", count, bench::MeasureMs([&] {
+                    Map<int, int> loaded(batch.begin(), batch.end());
+                    sum += loaded.size();
+                  }));
+    bench::Report("std::map range load", count, bench::MeasureMs([&] {
+                    std::map<int, int> loaded(batch.begin(), batch.end());
+                    sum += loaded.size();
+                  }));
+    std::sort(batch.begin(), batch.end());
+    bench::Report("s21::Map from_sorted", count, bench::MeasureMs([&] {
+                    auto loaded = Map<int, int>::from_sorted(batch.begin(),
+                                                             batch.end());
+                    sum += loaded.size();
+                  }));
+    bench::Report("std::map sorted range load", count, bench::MeasureMs([&] {
+                    std::map<int, int> loaded(batch.begin(), batch.end());
+                    sum += loaded.size();
+                  }));
+    bench::DoNotOptimize(sum);
+  }
+  return 0;
+}
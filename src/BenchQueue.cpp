@@ -0,0 +1,60 @@
+#include <queue>
+
+#include "benchmark.h"
+#include "containerAdaptor.h"
+#include "deque.h"
+#include "list.h"
+
+using namespace s21;
+
+//  Burst: push N then pop N. Steady: the queue holds a window of 1024 items
+//  while N items flow through it, as in a producer/consumer loop
+
+template <typename QueueType>
+void Burst(const char *name, size_t count) {
+  double ms = bench::MeasureMs([&] {
+    QueueType queue;
+    long sum{0};
+    for (size_t i{0}; i < count; i++) {
+      int value = static_cast<int>(i);
+      queue.push(value);
+    }
+    while (!queue.empty()) {
+      sum += queue.front();
+      queue.pop();
+    }
+    bench::DoNotOptimize(sum);
+  });
+  bench::Report(name, count, ms);
+}
+
+template <typename QueueType>
+void Steady(const char *name, size_t count) {
+  double ms = bench::MeasureMs([&] {
+    QueueType queue;
+    long sum{0};
+    for (size_t i{0}; i < count; i++) {
+      int value = static_cast<int>(i);
+      queue.push(value);
+      if (queue.size() > 1024) {
+        sum += queue.front();
+        queue.pop();
+      }
+    }
+    bench::DoNotOptimize(sum);
+  });
+  bench::Report(name, count, ms);
+}
+
+int main() {
+  const size_t count{10000000};
+  Burst<Queue<int>>("s21::Queue<RingBuffer> burst", count);
+  Burst<Queue<int, Deque<int>>>("s21::Queue<Deque> burst", count);
+  Burst<Queue<int, List<int>>>("s21::Queue<List> burst", count);
+  Burst<std::queue<int>>("std::queue burst", count);
+  Steady<Queue<int>>("s21::Queue<RingBuffer> steady", count);
+  Steady<Queue<int, Deque<int>>>("s21::Queue<Deque> steady", count);
+  Steady<Queue<int, List<int>>>("s21::Queue<List> steady", count);
+  Steady<std::queue<int>>("std::queue steady", count);
+  return 0;
+}
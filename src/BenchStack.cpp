@@ -0,0 +1,68 @@
+#include <stack>
+#include <vector>
+
+#include "benchmark.h"
+#include "containerAdaptor.h"
+#include "deque.h"
+#include "list.h"
+
+using namespace s21;
+
+//  Burst: push N then pop N. Dfs: the stack walks a complete binary tree of
+//  N nodes, it pushes both children of every popped node
+
+template <typename StackType>
+void Burst(const char *name, size_t count) {
+  double ms = bench::MeasureMs([&] {
+    StackType stack;
+    long sum{0};
+    for (size_t i{0}; i < count; i++) {
+      stack.push(static_cast<int>(i));
+    }
+    while (!stack.empty()) {
+      sum += stack.top();
+      stack.pop();
+    }
+    bench::DoNotOptimize(sum);
+  });
+  bench::Report(name, 2 * count, ms);
+}
+
+template <typename StackType>
+void Dfs(const char *name, size_t count) {
+  double ms = bench::MeasureMs([&] {
+    StackType stack;
+    long sum{0};
+    stack.push(0);
+    while (!stack.empty()) {
+      size_t node = stack.top();
+      stack.pop();
+      sum += node;
+      if (2 * node + 1 < count) {
+        stack.push(static_cast<int>(2 * node + 1));
+      }
+      if (2 * node + 2 < count) {
+        stack.push(static_cast<int>(2 * node + 2));
+      }
+    }
+    bench::DoNotOptimize(sum);
+  });
+  bench::Report(name, 2 * count, ms);
+}
+
+int main() {
+  const size_t count{10000000};
+  Burst<Stack<int>>("s21::Stack<Vector> burst", count);
+  Burst<Stack<int, RingBuffer<int>>>("s21::Stack<RingBuffer> burst", count);
+  Burst<Stack<int, Deque<int>>>("s21::Stack<Deque> burst", count);
+  Burst<Stack<int, List<int>>>("s21::Stack<List> burst", count);
+  Burst<std::stack<int>>("std::stack burst", count);
+  Burst<std::stack<int, std::vector<int>>>("std::stack<vector> burst", count);
+  Dfs<Stack<int>>("s21::Stack<Vector> dfs", count);
+  Dfs<Stack<int, RingBuffer<int>>>("s21::Stack<RingBuffer> dfs", count);
+  Dfs<Stack<int, Deque<int>>>("s21::Stack<Deque> dfs", count);
+  Dfs<Stack<int, List<int>>>("s21::Stack<List> dfs", count);
+  Dfs<std::stack<int>>("std::stack dfs", count);
+  Dfs<std::stack<int, std::vector<int>>>("std::stack<vector> dfs", count);
+  return 0;
+}
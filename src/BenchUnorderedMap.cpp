@@ -0,0 +1,59 @@
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "benchmark.h"
+#include "unorderedMap.h"
+
+using namespace s21;
+
+//  Insert, lookup of present and missing keys and erase of N random keys:
+//  every operation is O(1) on average, a lookup reads one group of
+//  control bytes and then mostly a single slot
+
+int main() {
+  for (size_t count : {100000, 1000000}) {
+    std::vector<int> keys(count);
+    std::mt19937 generator(21);
+    for (size_t i{0}; i < count; i++) {
+      keys[i] = static_cast<int>(generator() >> 1);
+    }
+    std::vector<int> missing(keys);
+    for (int &key : missing) key = -key - 1;
+
+    UnorderedMap<int, int> map;
+    std::unordered_map<int, int> reference;
+    long sum{0};
+
+    bench::Report("s21::UnorderedMap insert", count, bench::MeasureMs([&] {
+                    for (int key : keys) map.insert(key, key);
+                  }));
+    bench::Report("std::unordered_map insert", count, bench::MeasureMs([&] {
+                    for (int key : keys) reference.emplace(key, key);
+                  }));
+    std::shuffle(keys.begin(), keys.end(), generator);
+    bench::Report("s21::UnorderedMap at", count, bench::MeasureMs([&] {
+                    for (int key : keys) sum += map.at(key);
+                  }));
+    bench::Report("std::unordered_map at", count, bench::MeasureMs([&] {
+                    for (int key : keys) sum += reference.at(key);
+                  }));
+    bench::Report("s21::UnorderedMap contains (missing)", count,
+                  bench::MeasureMs([&] {
+                    for (int key : missing) sum += map.contains(key);
+                  }));
+    bench::Report("std::unordered_map contains (missing)", count,
+                  bench::MeasureMs([&] {
+                    for (int key : missing) sum += reference.contains(key);
+                  }));
+    bench::Report("s21::UnorderedMap erase", count, bench::MeasureMs([&] {
+                    for (int key : keys) sum += map.erase(key);
+                  }));
+    bench::Report("std::unordered_map erase", count, bench::MeasureMs([&] {
+                    for (int key : keys) sum += reference.erase(key);
+                  }));
+    bench::DoNotOptimize(sum);
+  }
+  return 0;
+}
@@ -0,0 +1,208 @@
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+#include "list.h"
+#include "smallVector.h"
+#include "vector.h"
+
+using namespace s21;
+
+//  Fill time has to grow linearly with the number of elements: ns/item
+//  stays flat from 1M up to 10M and the number of reallocations is O(log N)
+
+template <typename Growth>
+void FillVector(const char *name, size_t count) {
+  size_t reallocations{0};
+  double ms = bench::MeasureMs([&] {
+    Vector<int, Growth> vector;
+    size_t capacity{vector.capacity()};
+    for (size_t i{0}; i < count; i++) {
+      vector.push_back(static_cast<int>(i));
+      if (vector.capacity() != capacity) {
+        capacity = vector.capacity();
+        reallocations++;
+      }
+    }
+    bench::DoNotOptimize(vector.back());
+  });
+  bench::Report(name, count, ms);
+  std::printf("%-40s %10zu reallocations\n", "", reallocations);
+}
+
+void FillStdVector(size_t count) {
+  double ms = bench::MeasureMs([&] {
+    std::vector<int> vector;
+    for (size_t i{0}; i < count; i++) {
+      vector.push_back(static_cast<int>(i));
+    }
+    bench::DoNotOptimize(vector.back());
+  });
+  bench::Report("std::vector push_back", count, ms);
+}
+
+//  reserve only allocates: no element is constructed, so the time does not
+//  depend on the element type and untouched pages are never faulted in
+
+template <typename VectorType>
+void ReserveVector(const char *name, size_t count) {
+  double ms = bench::MeasureMs([&] {
+    VectorType vector;
+    vector.reserve(count);
+    bench::DoNotOptimize(vector.capacity());
+  });
+  bench::Report(name, count, ms);
+}
+
+//  64-character strings live on the heap: moving one hands its buffer over,
+//  copying allocates and copies it again, both on push_back and on growth
+
+template <typename VectorType>
+void FillStrings(const char *name, size_t count) {
+  double ms = bench::MeasureMs([&] {
+    VectorType vector;
+    for (size_t i{0}; i < count; i++) {
+      std::string payload(64, static_cast<char>('a' + i % 26));
+      vector.push_back(std::move(payload));
+    }
+    bench::DoNotOptimize(vector.back());
+  });
+  bench::Report(name, count, ms);
+}
+
+//  Each insert/erase in the middle of 1M ints shifts 2 MB; with memmove
+//  the shift runs at memory bandwidth
+
+template <typename VectorType>
+void InsertEraseMiddle(const char *name, size_t size, size_t count) {
+  VectorType vector;
+  vector.reserve(size + count);
+  for (size_t i{0}; i < size; i++) {
+    vector.push_back(static_cast<int>(i));
+  }
+  double ms = bench::MeasureMs([&] {
+    for (size_t i{0}; i < count; i++) {
+      vector.insert(vector.begin() + vector.size() / 2, static_cast<int>(i));
+    }
+    for (size_t i{0}; i < count; i++) {
+      vector.erase(vector.begin() + vector.size() / 2);
+    }
+  });
+  bench::DoNotOptimize(vector.back());
+  bench::Report(name, 2 * count, ms);
+  double bytes{2.0 * count * (size / 2) * sizeof(int)};
+  std::printf("%-40s %10.2f GB/s shifted\n", "", bytes / ms / 1e6);
+}
+
+//  Range-for over the vector: with a pointer iterator the loop is the same
+//  as over a plain array and gets vectorized
+
+template <typename VectorType>
+void LoopSum(const char *name, size_t count, int repeat) {
+  VectorType vector;
+  for (size_t i{0}; i < count; i++) {
+    vector.push_back(static_cast<int>(i));
+  }
+  long sum{0};
+  double ms = bench::MeasureMs([&] {
+    for (int r{0}; r < repeat; r++) {
+      for (int value : vector) {
+        sum += value;
+      }
+      bench::DoNotOptimize(sum);
+    }
+  });
+  bench::Report(name, count * repeat, ms);
+}
+
+void LoopSumArray(size_t count, int repeat) {
+  std::unique_ptr<int[]> array(new int[count]);
+  for (size_t i{0}; i < count; i++) {
+    array[i] = static_cast<int>(i);
+  }
+  long sum{0};
+  double ms = bench::MeasureMs([&] {
+    for (int r{0}; r < repeat; r++) {
+      for (size_t i{0}; i < count; i++) {
+        sum += array[i];
+      }
+      bench::DoNotOptimize(sum);
+    }
+  });
+  bench::Report("int[] loop sum", count * repeat, ms);
+}
+
+//  A short-lived vector of a few elements per "request": Vector and
+//  std::vector allocate for every one of them, SmallVector never does
+
+template <typename VectorType>
+void ManySmall(const char *name, size_t count, int elements) {
+  long sum{0};
+  double ms = bench::MeasureMs([&] {
+    for (size_t i{0}; i < count; i++) {
+      VectorType vector;
+      for (int j{0}; j < elements; j++) {
+        vector.push_back(j);
+      }
+      sum += vector.back();
+      bench::DoNotOptimize(sum);
+    }
+  });
+  bench::Report(name, count, ms);
+}
+
+//  A vector of containers of one element each: on growth a container that
+//  moves without throwing is moved (or byte copied when trivially
+//  relocatable) instead of copied with all of its nodes
+
+template <typename VectorType>
+void FillContainers(const char *name, size_t count) {
+  double ms = bench::MeasureMs([&] {
+    VectorType vector;
+    for (size_t i{0}; i < count; i++) {
+      vector.emplace_back();
+      vector.back().insert(vector.back().end(), static_cast<int>(i));
+    }
+    bench::DoNotOptimize(vector.back());
+  });
+  bench::Report(name, count, ms);
+}
+
+int main() {
+  FillContainers<Vector<List<int>>>("s21::Vector<List<int>> emplace_back",
+                                    1000000);
+  FillContainers<std::vector<std::list<int>>>(
+      "std::vector<std::list<int>> emplace_back", 1000000);
+  FillContainers<Vector<Vector<int>>>("s21::Vector<Vector<int>> emplace_back",
+                                      1000000);
+  FillContainers<std::vector<std::vector<int>>>(
+      "std::vector<std::vector<int>> emplace_back", 1000000);
+  ManySmall<Vector<int>>("s21::Vector<int> 8 elements", 1000000, 8);
+  ManySmall<SmallVector<int, 16>>("s21::SmallVector<int, 16> 8 elements",
+                                  1000000, 8);
+  ManySmall<std::vector<int>>("std::vector<int> 8 elements", 1000000, 8);
+  LoopSum<Vector<int>>("s21::Vector<int> range-for sum", 1000000, 100);
+  LoopSum<std::vector<int>>("std::vector<int> range-for sum", 1000000, 100);
+  LoopSumArray(1000000, 100);
+  InsertEraseMiddle<Vector<int>>("s21::Vector<int> insert/erase middle",
+                                 1000000, 1000);
+  InsertEraseMiddle<std::vector<int>>("std::vector<int> insert/erase middle",
+                                      1000000, 1000);
+  ReserveVector<Vector<std::string>>("s21::Vector<std::string> reserve",
+                                     10000000);
+  ReserveVector<std::vector<std::string>>("std::vector<std::string> reserve",
+                                          10000000);
+  FillStrings<Vector<std::string>>("s21::Vector<std::string> push_back",
+                                   1000000);
+  FillStrings<std::vector<std::string>>("std::vector<std::string> push_back",
+                                        1000000);
+  for (size_t count : {1000000, 2000000, 5000000, 10000000}) {
+    FillVector<GrowthDouble>("s21::Vector<GrowthDouble> push_back", count);
+    FillVector<GrowthOneAndHalf>("s21::Vector<GrowthOneAndHalf> push_back",
+                                 count);
+    FillStdVector(count);
+  }
+  return 0;
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "concurrentQueue.h"
+
+using namespace s21;
+
+TEST(SpscQueue, basic) {
+  SpscQueue<std::string, 4> Kala;
+
+  //  empty and size test
+
+  ASSERT_TRUE(Kala.empty());
+  ASSERT_EQ(0, Kala.size());
+  ASSERT_THROW(Kala.front(), std::out_of_range);
+  ASSERT_THROW(Kala.pop(), std::out_of_range);
+
+  //  push until full
+
+  ASSERT_TRUE(Kala.try_push("a"));
+  ASSERT_TRUE(Kala.try_push("b"));
+  ASSERT_TRUE(Kala.try_push("c"));
+  ASSERT_TRUE(Kala.try_push("d"));
+  ASSERT_FALSE(Kala.try_push("e"));
+  ASSERT_EQ(4, Kala.size());
+  ASSERT_EQ("a", Kala.front());
+
+  //  pop and wrap around
+
+  std::string value;
+  ASSERT_TRUE(Kala.try_pop(value));
+  ASSERT_EQ("a", value);
+  Kala.pop();
+  ASSERT_EQ("c", Kala.front());
+  Kala.push("e");
+  Kala.push("f");
+  ASSERT_EQ(4, Kala.size());
+
+  //  batches stop at the store bounds
+
+  std::string batch[4] = {"x", "y", "z", "w"};
+  ASSERT_EQ(0, Kala.try_push_n(batch, 4));
+
+  std::string popped[8];
+  ASSERT_EQ(4, Kala.try_pop_n(popped, 8));
+  ASSERT_EQ("c", popped[0]);
+  ASSERT_EQ("d", popped[1]);
+  ASSERT_EQ("e", popped[2]);
+  ASSERT_EQ("f", popped[3]);
+  ASSERT_TRUE(Kala.empty());
+
+  ASSERT_EQ(3, Kala.try_push_n(batch, 3));
+  ASSERT_EQ(1, Kala.try_push_n(batch + 1, 3));
+  ASSERT_EQ(0, Kala.try_pop_n(popped, 0));
+  ASSERT_EQ(4, Kala.try_pop_n(popped, 8));
+  ASSERT_EQ("x", popped[0]);
+  ASSERT_EQ("z", popped[2]);
+  ASSERT_EQ("y", popped[3]);
+}
+
+TEST(SpscQueue, two_threads) {
+  const int count{200000};
+  auto Kala = std::make_unique<SpscQueue<int, 1024>>();
+
+  //  every value arrives exactly once and in order
+
+  std::thread producer([&] {
+    int batch[16];
+    for (int i{0}; i < count;) {
+      if (i % 3 == 0) {
+        Kala->push(i++);
+      } else {
+        int size{0};
+        for (; size < 16 && i + size < count; size++) batch[size] = i + size;
+        i += static_cast<int>(Kala->try_push_n(batch, size));
+      }
+    }
+  });
+
+  int expected{0};
+  int batch[32];
+  SpinBackoff backoff;
+  while (expected < count) {
+    size_t popped = Kala->try_pop_n(batch, 32);
+    for (size_t i{0}; i < popped; i++) {
+      ASSERT_EQ(expected++, batch[i]);
+    }
+    if (popped == 0) backoff.Pause();
+  }
+  producer.join();
+  ASSERT_TRUE(Kala->empty());
+}
+
+TEST(MpmcQueue, basic) {
+  MpmcQueue<std::string, 2> Kala;
+
+  ASSERT_TRUE(Kala.empty());
+  ASSERT_EQ(2, Kala.capacity());
+
+  std::string value;
+  ASSERT_FALSE(Kala.try_pop(value));
+  ASSERT_TRUE(Kala.try_push("a"));
+  ASSERT_TRUE(Kala.try_push("b"));
+  ASSERT_FALSE(Kala.try_push("c"));
+  ASSERT_EQ(2, Kala.size());
+
+  //  slots are reused after the sequence wraps to the next lap
+
+  Kala.pop(value);
+  ASSERT_EQ("a", value);
+  Kala.push("c");
+  ASSERT_TRUE(Kala.try_pop(value));
+  ASSERT_EQ("b", value);
+  ASSERT_TRUE(Kala.try_pop(value));
+  ASSERT_EQ("c", value);
+  ASSERT_TRUE(Kala.empty());
+}
+
+TEST(MpmcQueue, many_threads) {
+  const int producers{4}, consumers{4}, count{50000};
+  auto Kala = std::make_unique<MpmcQueue<int, 256>>();
+  std::vector<std::thread> threads;
+  std::vector<long> sums(consumers, 0);
+  std::vector<int> popped(consumers, 0);
+
+  //  every value is delivered once and each producer's values stay ordered
+
+  for (int p{0}; p < producers; p++) {
+    threads.emplace_back([&, p] {
+      for (int i{0}; i < count; i++) {
+        Kala->push(p * count + i);
+      }
+    });
+  }
+  for (int c{0}; c < consumers; c++) {
+    threads.emplace_back([&, c] {
+      std::vector<int> last(producers, -1);
+      int value{0};
+      for (int i{0}; i < count; i++) {
+        Kala->pop(value);
+        int producer = value / count;
+        EXPECT_LT(last[producer], value);
+        last[producer] = value;
+        sums[c] += value;
+        popped[c] += 1;
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  long total{0};
+  int received{0};
+  for (int c{0}; c < consumers; c++) {
+    total += sums[c];
+    received += popped[c];
+  }
+  long all = static_cast<long>(producers) * count;
+  ASSERT_EQ(all, received);
+  ASSERT_EQ(all * (all - 1) / 2, total);
+  ASSERT_TRUE(Kala->empty());
+}
+
+int main() {
+  testing::InitGoogleTest();
+  return RUN_ALL_TESTS();
+}
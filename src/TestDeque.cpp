@@ -0,0 +1,255 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "containerAdaptor.h"
+#include "deque.h"
+
+using namespace s21;
+
+TEST(Deque, basic) {
+  Deque<int> Kala;
+
+  ASSERT_TRUE(Kala.empty());
+  ASSERT_EQ(Kala.size(), 0);
+  ASSERT_EQ(Kala.begin(), Kala.end());
+  ASSERT_THROW(Kala.at(0), std::out_of_range);
+
+  //  both ends
+
+  Kala.push_back(1);
+  Kala.push_back(2);
+  Kala.push_front(0);
+  Kala.push_front(-1);
+
+  ASSERT_EQ(Kala.size(), 4);
+  ASSERT_EQ(Kala.front(), -1);
+  ASSERT_EQ(Kala.back(), 2);
+  ASSERT_EQ(Kala[1], 0);
+  ASSERT_EQ(Kala.at(3), 2);
+  ASSERT_THROW(Kala.at(4), std::out_of_range);
+
+  Kala.front() = 10;
+  Kala.back() = 20;
+  ASSERT_EQ(Kala[0], 10);
+  ASSERT_EQ(Kala[3], 20);
+
+  Kala.pop_front();
+  Kala.pop_back();
+  ASSERT_EQ(Kala.size(), 2);
+  ASSERT_EQ(Kala.front(), 0);
+  ASSERT_EQ(Kala.back(), 1);
+
+  //  many blocks on both sides
+
+  for (int i{0}; i < 10000; i++) {
+    Kala.push_back(i);
+    Kala.push_front(-i);
+  }
+  ASSERT_EQ(Kala.size(), 20002);
+  ASSERT_EQ(Kala.front(), -9999);
+  ASSERT_EQ(Kala.back(), 9999);
+  ASSERT_EQ(Kala[10000], 0);
+  ASSERT_EQ(Kala.end() - Kala.begin(), 20002);
+
+  Kala.clear();
+  ASSERT_TRUE(Kala.empty());
+  Kala.push_front(5);
+  ASSERT_EQ(Kala.back(), 5);
+}
+
+//  references to elements stay valid while the deque grows and shrinks at
+//  its ends
+
+TEST(Deque, stable_references) {
+  Deque<std::string> Kala = {"a", "b", "c"};
+  std::string *Middle{&Kala[1]};
+
+  for (int i{0}; i < 5000; i++) {
+    Kala.push_back(std::to_string(i));
+    Kala.push_front(std::to_string(-i));
+  }
+  for (int i{0}; i < 4000; i++) {
+    Kala.pop_back();
+    Kala.pop_front();
+  }
+
+  ASSERT_EQ(*Middle, "b");
+  ASSERT_EQ(Middle, &Kala[Kala.size() / 2]);
+
+  //  a reference to an element is a valid argument of push
+
+  Kala.push_back(Kala.front());
+  Kala.push_front(Kala.back());
+  ASSERT_EQ(Kala.front(), Kala.back());
+}
+
+TEST(Deque, iterators) {
+  Deque<int> Kala;
+  for (int i{0}; i < 5000; i++) {
+    Kala.push_front(i * 7919 % 5003);
+  }
+
+  static_assert(std::random_access_iterator<Deque<int>::iterator>);
+  static_assert(std::random_access_iterator<Deque<int>::const_iterator>);
+
+  std::sort(Kala.begin(), Kala.end());
+  ASSERT_TRUE(std::is_sorted(Kala.begin(), Kala.end()));
+
+  auto iter = Kala.begin() + 3000;
+  ASSERT_EQ(*iter, Kala[3000]);
+  iter -= 2999;
+  ASSERT_EQ(*iter, Kala[1]);
+  ASSERT_EQ(iter[1500], Kala[1501]);
+  ASSERT_EQ(Kala.end() - iter, 4999);
+  ASSERT_LT(iter, Kala.end());
+
+  const Deque<int> &Constant{Kala};
+  long sum{0};
+  for (int value : Constant) {
+    sum += value;
+  }
+  long expected{0};
+  for (size_t i{0}; i < Kala.size(); i++) {
+    expected += Kala[i];
+  }
+  ASSERT_EQ(sum, expected);
+  Deque<int>::const_iterator Converted{Kala.begin()};
+  ASSERT_EQ(Converted, Constant.begin());
+}
+
+TEST(Deque, against_std) {
+  Deque<std::string> Kala;
+  std::deque<std::string> Reference;
+
+  for (int i{0}; i < 20000; i++) {
+    int action{i * 31 % 7};
+    if (action < 2) {
+      Kala.push_back(std::to_string(i));
+      Reference.push_back(std::to_string(i));
+    } else if (action < 4) {
+      Kala.emplace_front(3, static_cast<char>('a' + i % 26));
+      Reference.emplace_front(3, static_cast<char>('a' + i % 26));
+    } else if (action == 4 && !Reference.empty()) {
+      Kala.pop_back();
+      Reference.pop_back();
+    } else if (!Reference.empty()) {
+      Kala.pop_front();
+      Reference.pop_front();
+    }
+    ASSERT_EQ(Kala.size(), Reference.size());
+    if (!Reference.empty()) {
+      ASSERT_EQ(Kala.front(), Reference.front());
+      ASSERT_EQ(Kala.back(), Reference.back());
+    }
+  }
+  ASSERT_TRUE(std::equal(Kala.begin(), Kala.end(), Reference.begin(),
+                         Reference.end()));
+}
+
+TEST(Deque, copy_move_swap) {
+  static_assert(std::is_nothrow_move_constructible_v<Deque<std::string>>);
+  static_assert(std::is_nothrow_move_assignable_v<Deque<std::string>>);
+  static_assert(is_trivially_relocatable_v<Deque<std::string>>);
+
+  Deque<std::unique_ptr<int>> Pointers;
+  for (int i{0}; i < 3000; i++) {
+    Pointers.emplace_back(new int(i));
+  }
+
+  Deque<std::unique_ptr<int>> Moved(std::move(Pointers));
+  ASSERT_TRUE(Pointers.empty());
+  ASSERT_EQ(Moved.size(), 3000);
+  ASSERT_EQ(*Moved.back(), 2999);
+
+  Pointers = std::move(Moved);
+  ASSERT_EQ(*Pointers.front(), 0);
+  ASSERT_TRUE(Moved.empty());
+
+  Deque<std::string> Strings = {"one", "two"};
+  Deque<std::string> Copied(Strings);
+  Copied.push_back("three");
+  ASSERT_EQ(Strings.size(), 2);
+
+  Strings.swap(Copied);
+  ASSERT_EQ(Strings.size(), 3);
+  ASSERT_EQ(Copied.back(), "two");
+}
+
+//  Deque as the store of the adaptors
+
+//  a copy that throws halfway frees the blocks and the map it built
+
+struct Fragile {
+  static inline int CopiesLeft{-1};
+  std::string Value;
+  Fragile(int value) : Value(std::to_string(value)) {}
+  Fragile(const Fragile &other) : Value(other.Value) {
+    if (CopiesLeft-- == 0) {
+      throw std::runtime_error("copy");
+    }
+  }
+};
+
+TEST(Deque, copy_throwing) {
+  Deque<Fragile> Kala;
+  for (int i{0}; i < 1000; i++) {
+    Kala.emplace_back(i);
+  }
+  Fragile::CopiesLeft = 500;
+  ASSERT_THROW(Deque<Fragile>{Kala}, std::runtime_error);
+  Fragile::CopiesLeft = -1;
+  ASSERT_EQ(Kala.size(), 1000);
+  ASSERT_EQ(Kala.back().Value, "999");
+}
+
+TEST(Deque, adaptors) {
+  Queue<int, Deque<int>> Line;
+  Stack<int, Deque<int>> Pile = {1, 2, 3};
+
+  for (int i{0}; i < 10000; i++) {
+    Line.push(i);
+    Pile.push(i);
+    if (i % 2 == 1) {
+      Line.pop();
+    }
+  }
+  ASSERT_EQ(Line.size(), 5000);
+  ASSERT_EQ(Line.front(), 5000);
+  ASSERT_EQ(Line.back(), 9999);
+  ASSERT_EQ(Pile.size(), 10003);
+  ASSERT_EQ(Pile.top(), 9999);
+  ASSERT_EQ(Pile.emplace(-1), -1);
+  ASSERT_EQ(Pile.top(), -1);
+}
+
+TEST(Deque, pmr_monotonic_buffer) {
+  std::pmr::monotonic_buffer_resource Resource;
+  pmr::Deque<int> Kala(&Resource);
+  for (int i{0}; i < 10000; i++) {
+    Kala.push_back(i);
+  }
+  ASSERT_EQ(Kala.get_allocator().resource(), &Resource);
+
+  //  a deque over another resource takes the elements, not the blocks
+
+  std::pmr::unsynchronized_pool_resource OtherResource;
+  pmr::Deque<int> Other(&OtherResource);
+  Other = std::move(Kala);
+  ASSERT_EQ(Other.get_allocator().resource(), &OtherResource);
+  ASSERT_EQ(Other.size(), 10000);
+  ASSERT_EQ(Other[9999], 9999);
+  ASSERT_TRUE(Kala.empty());
+}
+
+int main() {
+  testing::InitGoogleTest();
+  return RUN_ALL_TESTS();
+}
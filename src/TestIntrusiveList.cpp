@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "intrusiveList.h"
+
+using namespace s21;
+
+// an object with a hook for each of the two lists it can be in
+
+struct Timer {
+  explicit Timer(int deadline) : Deadline(deadline) {}
+
+  std::string Name{"timer"};
+  int Deadline;
+  ListHook Hook;
+  ListHook Expired;
+};
+
+typedef IntrusiveList<Timer, &Timer::Hook> TimerList;
+typedef IntrusiveList<Timer, &Timer::Expired> ExpiredList;
+
+template <typename ListType>
+std::vector<int> Deadlines(ListType& list) {
+  std::vector<int> deadlines;
+  for (Timer& timer : list) {
+    deadlines.push_back(timer.Deadline);
+  }
+  return deadlines;
+}
+
+TEST(IntrusiveList, basic) {
+  static_assert(std::bidirectional_iterator<TimerList::iterator>);
+
+  std::vector<Timer> Timers;
+  for (int i = 0; i < 5; i++) {
+    Timers.emplace_back(i);
+  }
+  TimerList Kala;
+  ASSERT_TRUE(Kala.empty());
+  ASSERT_TRUE(Kala.begin() == Kala.end());
+
+  for (Timer& timer : Timers) {
+    Kala.push_back(timer);
+  }
+  ASSERT_EQ(Kala.size(), 5);
+  ASSERT_EQ(&Kala.front(), &Timers[0]);
+  ASSERT_EQ(&Kala.back(), &Timers[4]);
+  ASSERT_TRUE(Timers[2].Hook.is_linked());
+  ASSERT_FALSE(Timers[2].Expired.is_linked());
+
+  // erased through the object alone, no search
+  Kala.erase(Timers[2]);
+  ASSERT_FALSE(Timers[2].Hook.is_linked());
+  ASSERT_EQ(Deadlines(Kala), std::vector<int>({0, 1, 3, 4}));
+
+  Kala.push_front(Timers[2]);
+  Kala.pop_back();
+  ASSERT_EQ(Deadlines(Kala), std::vector<int>({2, 0, 1, 3}));
+  auto iter = Kala.insert(Kala.iterator_to(Timers[1]), Timers[4]);
+  ASSERT_EQ(iter->Deadline, 4);
+  iter = Kala.erase(Kala.iterator_to(Timers[0]));
+  ASSERT_EQ(&*iter, &Timers[4]);
+  ASSERT_EQ(Deadlines(Kala), std::vector<int>({2, 4, 1, 3}));
+  ASSERT_EQ((--Kala.end())->Name, "timer");
+
+  // the same object in a second list through its second hook
+  ExpiredList Expired;
+  Expired.push_back(Timers[1]);
+  Expired.push_back(Timers[0]);
+  ASSERT_EQ(Deadlines(Expired), std::vector<int>({1, 0}));
+  ASSERT_EQ(Deadlines(Kala), std::vector<int>({2, 4, 1, 3}));
+
+  // a copy is in no list
+  Timer Copied(Timers[1]);
+  ASSERT_FALSE(Copied.Hook.is_linked());
+
+  Kala.clear();
+  ASSERT_TRUE(Kala.empty());
+  ASSERT_FALSE(Timers[4].Hook.is_linked());
+  Kala.pop_front();
+  ASSERT_EQ(Kala.size(), 0);
+}
+
+TEST(IntrusiveList, splice_move_swap) {
+  std::vector<Timer> Timers;
+  for (int i = 0; i < 6; i++) {
+    Timers.emplace_back(i);
+  }
+  TimerList Kala, Other;
+  for (int i = 0; i < 3; i++) {
+    Kala.push_back(Timers[i]);
+    Other.push_back(Timers[i + 3]);
+  }
+
+  Kala.splice(Kala.iterator_to(Timers[1]), Other, Other.iterator_to(Timers[5]));
+  ASSERT_EQ(Deadlines(Kala), std::vector<int>({0, 5, 1, 2}));
+  ASSERT_EQ(Other.size(), 2);
+  Kala.splice(Kala.end(), Other);
+  ASSERT_EQ(Deadlines(Kala), std::vector<int>({0, 5, 1, 2, 3, 4}));
+  ASSERT_TRUE(Other.empty());
+
+  TimerList Moved(std::move(Kala));
+  ASSERT_TRUE(Kala.empty());
+  ASSERT_EQ(Moved.size(), 6);
+  Moved.erase(Timers[3]);
+  ASSERT_EQ(Deadlines(Moved), std::vector<int>({0, 5, 1, 2, 4}));
+
+  Other.push_back(Timers[3]);
+  Other.swap(Moved);
+  ASSERT_EQ(Deadlines(Other), std::vector<int>({0, 5, 1, 2, 4}));
+  ASSERT_EQ(Deadlines(Moved), std::vector<int>({3}));
+  Moved = std::move(Other);
+  ASSERT_FALSE(Timers[3].Hook.is_linked());
+  ASSERT_EQ(Moved.size(), 5);
+  ASSERT_EQ(&Moved.back(), &Timers[4]);
+}
+
+TEST(IntrusiveList, against_std) {
+  std::mt19937 generator(23);
+  std::vector<Timer> Timers;
+  for (int i = 0; i < 1000; i++) {
+    Timers.emplace_back(i);
+  }
+  TimerList Kala;
+  std::list<int> Reference;
+  for (int i = 0; i < 20000; i++) {
+    Timer& timer = Timers[generator() % Timers.size()];
+    if (timer.Hook.is_linked()) {
+      Kala.erase(timer);
+      Reference.remove(timer.Deadline);
+    } else if (generator() % 2 == 0) {
+      Kala.push_back(timer);
+      Reference.push_back(timer.Deadline);
+    } else {
+      Kala.push_front(timer);
+      Reference.push_front(timer.Deadline);
+    }
+    ASSERT_EQ(Kala.size(), Reference.size());
+  }
+  ASSERT_EQ(Deadlines(Kala),
+            std::vector<int>(Reference.begin(), Reference.end()));
+}
+
+int main() {
+  testing::InitGoogleTest();
+  return RUN_ALL_TESTS();
+}
@@ -1,6 +1,14 @@
 #include <gtest/gtest.h>
 
+#include <list>
+#include <memory_resource>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
 #include "list.h"
+#include "poolAllocator.h"
 using namespace s21;
 
 TEST(List, simple_constructor) {
@@ -214,6 +222,329 @@ TEST(List, operator_minus) {
   ASSERT_EQ(*iter, 3);
 }
 
+// the algorithms relink nodes: an element keeps its address wherever it
+// moves
+
+template <typename Type>
+std::vector<Type> Values(List<Type>& list) {
+  std::vector<Type> values;
+  for (auto iter = list.begin(); iter != list.end(); ++iter) {
+    values.push_back(*iter);
+  }
+  return values;
+}
+
+TEST(List, sort_against_std) {
+  std::mt19937 generator(21);
+  List<std::pair<int, int>> Kala;
+  std::list<std::pair<int, int>> Reference;
+  for (int i = 0; i < 10000; i++) {
+    auto value = std::make_pair(static_cast<int>(generator() % 100), i);
+    Kala.push_back(value);
+    Reference.push_back(value);
+  }
+  std::pair<int, int>* Front = &Kala.front();
+
+  // stable: equal first members keep their order
+  auto ByFirst = [](const auto& left, const auto& right) {
+    return left.first < right.first;
+  };
+  Kala.sort(ByFirst);
+  Reference.sort(ByFirst);
+  std::vector<std::pair<int, int>> Expected(Reference.begin(),
+                                            Reference.end());
+  ASSERT_EQ(Values(Kala), Expected);
+  bool found = false;
+  for (auto iter = Kala.begin(); iter != Kala.end(); ++iter) {
+    found = found || &*iter == Front;
+  }
+  ASSERT_TRUE(found);
+  ASSERT_EQ(Kala.size(), 10000);
+
+  // backwards through the rebuilt _prev links
+  auto iter = Kala.end();
+  --iter;
+  ASSERT_EQ(*iter, Reference.back());
+
+  List<int> Small = {3, 1, 2};
+  Small.sort();
+  ASSERT_EQ(Values(Small), std::vector<int>({1, 2, 3}));
+  List<int> Empty;
+  Empty.sort();
+  ASSERT_TRUE(Empty.empty());
+}
+
+TEST(List, sort_throwing_compare) {
+  List<int> Kala;
+  for (int i = 0; i < 1000; i++) {
+    Kala.push_back((i * 7919) % 1000);
+  }
+  int calls = 0;
+  ASSERT_THROW(Kala.sort([&calls](int left, int right) {
+    if (++calls == 3000) throw std::runtime_error("compare");
+    return left < right;
+  }),
+               std::runtime_error);
+  std::vector<int> values = Values(Kala);
+  ASSERT_EQ(values.size(), 1000);
+  std::sort(values.begin(), values.end());
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_EQ(values[i], i);
+  }
+  Kala.sort();
+  ASSERT_EQ(Kala.front(), 0);
+  ASSERT_EQ(Kala.back(), 999);
+}
+
+TEST(List, merge_stable) {
+  List<std::pair<int, char>> Kala = {{1, 'a'}, {3, 'a'}, {3, 'b'}, {7, 'a'}};
+  List<std::pair<int, char>> Other = {{0, 'o'}, {3, 'o'}, {8, 'o'}};
+  std::pair<int, char>* Moved = &Other.front();
+  auto ByFirst = [](const auto& left, const auto& right) {
+    return left.first < right.first;
+  };
+  Kala.merge(Other, ByFirst);
+  ASSERT_TRUE(Other.empty());
+  ASSERT_EQ(Other.size(), 0);
+  ASSERT_EQ(&Kala.front(), Moved);
+  ASSERT_EQ(Values(Kala), (std::vector<std::pair<int, char>>{{0, 'o'},
+                                                             {1, 'a'},
+                                                             {3, 'a'},
+                                                             {3, 'b'},
+                                                             {3, 'o'},
+                                                             {7, 'a'},
+                                                             {8, 'o'}}));
+
+  // into a cleared list and back
+  Kala.clear();
+  List<int> Numbers = {1, 2};
+  List<int> Cleared;
+  Cleared.clear();
+  Cleared.merge(Numbers);
+  ASSERT_EQ(Values(Cleared), std::vector<int>({1, 2}));
+  Numbers.push_back(0);
+  Numbers.merge(Cleared);
+  ASSERT_EQ(Values(Numbers), std::vector<int>({0, 1, 2}));
+}
+
+TEST(List, splice_reverse_unique_relink) {
+  List<int> Kala = {1, 2, 3};
+  List<int> Other = {4, 5, 6};
+  int* Five = &*(Other.begin() + 1);
+  auto iter = Kala.begin();
+  ++iter;
+  Kala.splice(iter, Other);
+  ASSERT_EQ(Values(Kala), std::vector<int>({1, 4, 5, 6, 2, 3}));
+  ASSERT_EQ(&*(Kala.begin() + 2), Five);
+  ASSERT_TRUE(Other.empty());
+  ASSERT_EQ(Kala.size(), 6);
+
+  // one element, to the end and into an empty list
+  Kala.splice(Kala.end(), Kala, Kala.begin());
+  ASSERT_EQ(Values(Kala), std::vector<int>({4, 5, 6, 2, 3, 1}));
+  Other.splice(Other.begin(), Kala, Kala.begin() + 1);
+  ASSERT_EQ(Values(Other), std::vector<int>({5}));
+  ASSERT_EQ(&Other.front(), Five);
+  ASSERT_EQ(Kala.size(), 5);
+  ASSERT_EQ(Other.size(), 1);
+
+  Kala.reverse();
+  ASSERT_EQ(Values(Kala), std::vector<int>({1, 3, 2, 6, 4}));
+  ASSERT_EQ(Kala.back(), 4);
+  auto last = Kala.end();
+  --last;
+  ASSERT_EQ(*last, 4);
+
+  // only adjacent duplicates go
+  List<int> Runs = {1, 1, 2, 1, 1, 3, 3};
+  int* First = &Runs.front();
+  Runs.unique();
+  ASSERT_EQ(Values(Runs), std::vector<int>({1, 2, 1, 3}));
+  ASSERT_EQ(&Runs.front(), First);
+  ASSERT_EQ(Runs.size(), 4);
+}
+
+TEST(List, pool_allocator) {
+  List<int, PoolAllocator<int>> pooled;
+  for (int i = 0; i < 1000; i++) {
+    pooled.push_back(i);
+  }
+  ASSERT_EQ(0, pooled.front());
+  ASSERT_EQ(999, pooled.back());
+  ASSERT_EQ(4, pooled.get_allocator().chunks());
+
+  // erased nodes are reused before a new chunk is carved
+  List<int, PoolAllocator<int>>::ListIterator iter = pooled.begin();
+  pooled.erase(iter + 1);
+  pooled.insert(pooled.begin(), -1);
+  ASSERT_EQ(-1, pooled.front());
+  ASSERT_EQ(4, pooled.get_allocator().chunks());
+
+  // a copy gets its own pool, clear() returns all chunks at once
+  List<int, PoolAllocator<int>> copied(pooled);
+  ASSERT_TRUE(copied.get_allocator() != pooled.get_allocator());
+  pooled.clear();
+  ASSERT_EQ(0, pooled.get_allocator().chunks());
+  ASSERT_TRUE(pooled.empty());
+  pooled.push_back(5);
+  ASSERT_EQ(5, pooled.front());
+
+  int sum = 0;
+  for (iter = copied.begin(); iter != copied.end(); ++iter) sum += *iter;
+  ASSERT_EQ(999 * 1000 / 2 - 1 - 1, sum);
+
+  // non-trivial values are still destroyed one by one
+  List<std::string, PoolAllocator<std::string>> strings = {"a", "b", "c"};
+  strings.clear();
+  ASSERT_TRUE(strings.empty());
+}
+
+TEST(List, pmr_monotonic_buffer) {
+  std::byte buffer[16 * 1024];
+  std::pmr::monotonic_buffer_resource resource(
+      buffer, sizeof(buffer), std::pmr::null_memory_resource());
+  s21::pmr::List<int> list(&resource);
+  for (int i = 0; i < 100; i++) {
+    list.push_back(i);
+  }
+  int expected = 0;
+  for (auto iter = list.begin(); iter != list.end(); ++iter) {
+    ASSERT_EQ(*iter, expected++);
+  }
+  ASSERT_EQ(expected, 100);
+  ASSERT_EQ(list.get_allocator().resource(), &resource);
+}
+
+// the sentinel lives in the list: an empty list allocates nothing, moves
+// and swaps relink the two ends and every node stays where it is
+
+TEST(List, move_and_swap_relink) {
+  List<std::string> Kala;
+  ASSERT_TRUE(Kala.begin() == Kala.end());
+  for (int i = 0; i < 100; i++) {
+    Kala.push_back(std::to_string(i));
+  }
+  std::string* Front = &Kala.front();
+  std::string* Back = &Kala.back();
+
+  List<std::string> Moved(std::move(Kala));
+  ASSERT_TRUE(Kala.empty());
+  ASSERT_TRUE(Kala.begin() == Kala.end());
+  ASSERT_EQ(&Moved.front(), Front);
+  ASSERT_EQ(&Moved.back(), Back);
+  ASSERT_EQ(Moved.size(), 100);
+  ASSERT_EQ(*(--Moved.end()), "99");
+
+  Kala.push_back("reused");
+  Kala = std::move(Moved);
+  ASSERT_TRUE(Moved.empty());
+  ASSERT_EQ(&Kala.front(), Front);
+  ASSERT_EQ(Values(Kala).size(), 100);
+
+  List<std::string> Other = {"a", "b"};
+  Kala.swap(Other);
+  ASSERT_EQ(Values(Kala), std::vector<std::string>({"a", "b"}));
+  ASSERT_EQ(&Other.front(), Front);
+  ASSERT_EQ(&Other.back(), Back);
+  Other.swap(Moved);
+  ASSERT_TRUE(Other.empty());
+  ASSERT_EQ(&Moved.back(), Back);
+
+  // the values of a list over another resource are moved into our nodes
+  std::pmr::monotonic_buffer_resource Resource;
+  std::pmr::unsynchronized_pool_resource OtherResource;
+  s21::pmr::List<std::string> Here(&Resource);
+  s21::pmr::List<std::string> There(&OtherResource);
+  There.push_back(std::string(100, 'x'));
+  Here = std::move(There);
+  ASSERT_EQ(Here.get_allocator().resource(), &Resource);
+  ASSERT_EQ(Here.front(), std::string(100, 'x'));
+  ASSERT_TRUE(There.empty());
+}
+
+// a list moves without throwing, so a growing vector of lists moves them
+// and the nodes stay where they were; the sentinel inside the list keeps
+// its bytes from being relocated
+TEST(List, vector_of_lists) {
+  static_assert(std::is_nothrow_move_constructible_v<List<std::string>>);
+  static_assert(std::is_nothrow_move_assignable_v<List<std::string>>);
+  static_assert(!is_trivially_relocatable_v<List<std::string>>);
+
+  std::vector<List<std::string>> Lists;
+  std::vector<const std::string*> Elements;
+  for (int i = 0; i < 100; i++) {
+    Lists.emplace_back();
+    Lists.back().push_back(std::to_string(i));
+    Elements.push_back(&Lists.back().front());
+  }
+  for (int i = 0; i < 100; i++) {
+    ASSERT_EQ(&Lists[i].front(), Elements[i]);
+    ASSERT_EQ(*Lists[i].begin(), std::to_string(i));
+    ASSERT_TRUE(++Lists[i].begin() == Lists[i].end());
+  }
+}
+
+// copying throws on the chosen call, moving may throw, so compact() copies
+
+struct Fragile {
+  static inline int copies = 0;
+  static inline int failing = -1;
+
+  explicit Fragile(int value) : Value(value) {}
+  Fragile(const Fragile& other) : Value(other.Value) {
+    if (++copies == failing) throw std::runtime_error("copy");
+  }
+  Fragile(Fragile&& other) : Value(other.Value) {}
+
+  int Value;
+};
+
+TEST(List, compact_address_order) {
+  std::mt19937 generator(25);
+  List<std::string> Kala;
+  for (int i = 0; i < 1000; i++) {
+    Kala.push_back(std::to_string(generator() % 10000));
+  }
+  // sorting relinks the nodes, which leaves them all over the heap
+  Kala.sort();
+  std::vector<std::string> sorted = Values(Kala);
+  Kala.compact();
+  ASSERT_EQ(Values(Kala), sorted);
+  ASSERT_EQ(Kala.size(), 1000);
+  List<std::string>::iterator iter = Kala.begin(), next = Kala.begin();
+  for (++next; next != Kala.end(); ++iter, ++next) {
+    ASSERT_LT(iter.GetPointer(), next.GetPointer());
+  }
+  ASSERT_EQ(*(--Kala.end()), sorted.back());
+
+  List<Fragile> Fragiles;
+  for (int i = 0; i < 100; i++) {
+    Fragiles.push_back(Fragile(i));
+  }
+  Fragile* front = &Fragiles.front();
+  Fragile::copies = 0;
+  Fragile::failing = 50;
+  ASSERT_THROW(Fragiles.compact(), std::runtime_error);
+  Fragile::failing = -1;
+  ASSERT_EQ(&Fragiles.front(), front);
+  int expected = 0;
+  for (auto each = Fragiles.begin(); each != Fragiles.end(); ++each) {
+    ASSERT_EQ((*each).Value, expected++);
+  }
+  ASSERT_EQ(expected, 100);
+
+  List<int, PoolAllocator<int>> pooled;
+  for (int i = 0; i < 1000; i++) {
+    pooled.push_front(i);
+  }
+  pooled.reverse();
+  pooled.compact();
+  expected = 0;
+  for (auto each = pooled.begin(); each != pooled.end(); ++each) {
+    ASSERT_EQ(*each, expected++);
+  }
+}
+
 int main() {
   testing::InitGoogleTest();
   return RUN_ALL_TESTS();
@@ -4,6 +4,14 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <vector>
+
 #include "map.h"
 #include "vector.h"
 
@@ -15,7 +23,6 @@ TEST(Map, basic) {
   //  Emptiness check
 
   ASSERT_EQ(Kala.size(), 0);
-  ASSERT_EQ(Kala.max_size(), 0);
   ASSERT_TRUE(Kala.empty());
 
   //  Pairs initialization
@@ -98,7 +105,6 @@ TEST(Map, basic) {
                               pair_6, pair_1, pair_8, pair_4};
 
   ASSERT_EQ(KalaSorted.size(), 8);
-  ASSERT_EQ(KalaSorted.max_size(), 8);
 
   Map<int, int>::iterator sortIterB(KalaSorted.begin());
   Map<int, int>::iterator sortIterE(KalaSorted.end());
@@ -120,14 +126,12 @@ TEST(Map, basic) {
   KalaSorted.clear();
 
   ASSERT_EQ(KalaSorted.size(), 0);
-  ASSERT_EQ(KalaSorted.max_size(), 0);
   ASSERT_TRUE(KalaSorted.empty());
 
   Map<int, int> KalaInit = {pair_1, pair_2, pair_3, pair_4,
                             pair_5, pair_6, pair_7, pair_8};
 
   ASSERT_EQ(KalaInit.size(), 8);
-  ASSERT_EQ(KalaInit.max_size(), 8);
 
   Map<int, int>::iterator sortItersB(KalaInit.begin());
   Map<int, int>::iterator sortItersE(KalaInit.end());
@@ -163,7 +167,6 @@ TEST(Map, basic) {
   KalaInit.merge(KalaToMerge);
 
   ASSERT_EQ(KalaInit.size(), 13);
-  ASSERT_EQ(KalaInit.max_size(), 13);
 
   ASSERT_TRUE(KalaSorted.empty());
 
@@ -197,6 +200,440 @@ TEST(Map, basic) {
   // KalaInit.CheckSorted();
 }
 
+TEST(Map, tree_against_std) {
+  Map<int, int> Kala;
+  std::map<int, int> Reference;
+  std::mt19937 generator(21);
+  std::uniform_int_distribution<int> keys(0, 2000);
+
+  //  Random inserts and erases keep the tree balanced and in key order
+
+  for (int i{0}; i < 20000; i++) {
+    int key = keys(generator);
+    if (i % 3 == 0 && Kala.contains(key)) {
+      Kala.erase(Kala.FindPosition(key).first);
+      Reference.erase(key);
+    } else {
+      ASSERT_EQ(Kala.insert(key, i).second, Reference.emplace(key, i).second);
+    }
+    ASSERT_EQ(Kala.size(), Reference.size());
+  }
+
+  auto iter = Kala.begin();
+  for (auto &pair : Reference) {
+    ASSERT_EQ((*iter).first, pair.first);
+    ASSERT_EQ((*iter).second, pair.second);
+    ASSERT_EQ(Kala.at(pair.first), pair.second);
+    ++iter;
+  }
+  ASSERT_EQ(iter.GetNode(), nullptr);
+
+  Kala[5000] = 1;
+  ASSERT_EQ(Kala[5000], 1);
+  ASSERT_EQ(Kala.size(), Reference.size() + 1);
+  ASSERT_THROW(Kala.at(-1), std::out_of_range);
+
+  Map<int, int> KalaCopied(Kala);
+  Kala.clear();
+  ASSERT_TRUE(Kala.empty());
+  ASSERT_EQ(KalaCopied.size(), Reference.size() + 1);
+}
+
+TEST(Map, pmr_monotonic_buffer) {
+  std::byte Buffer[64 * 1024];
+  std::pmr::monotonic_buffer_resource Resource(Buffer, sizeof(Buffer),
+                                               std::pmr::null_memory_resource());
+  s21::pmr::Map<int, int> Kala(&Resource);
+  for (int i{0}; i < 1000; i++) {
+    Kala.insert(i * 7 % 1000, i);
+  }
+  ASSERT_EQ(Kala.size(), 1000);
+  ASSERT_EQ(Kala.at(7), 1);
+  ASSERT_EQ((*Kala.begin()).first, 0);
+  ASSERT_EQ(Kala.get_allocator().resource(), &Resource);
+
+  Kala.erase(Kala.begin());
+  ASSERT_EQ((*Kala.begin()).first, 1);
+
+  s21::pmr::Map<int, int> Moved(std::move(Kala));
+  ASSERT_EQ(Moved.size(), 999);
+  ASSERT_EQ(Moved.get_allocator().resource(), &Resource);
+  ASSERT_TRUE(Kala.empty());
+}
+
+//  a frozen map answers lookups from the static index until it changes
+
+TEST(Map, frozen_lookup) {
+  Map<int, int> Kala;
+  std::map<int, int> Reference;
+  std::mt19937 generator(21);
+  std::uniform_int_distribution<int> keys(-50000, 50000);
+  for (int i{0}; i < 10000; i++) {
+    int key = keys(generator);
+    Kala.insert(key, i);
+    Reference.emplace(key, i);
+  }
+
+  Kala.Freeze();
+  ASSERT_TRUE(Kala.IsFrozen());
+  for (int key{-50010}; key <= 50010; key++) {
+    auto found = Reference.find(key);
+    ASSERT_EQ(Kala.contains(key), found != Reference.end());
+    if (found != Reference.end()) {
+      auto position = Kala.FindPosition(key);
+      ASSERT_EQ((*position.first).first, key);
+      ASSERT_EQ(Kala.at(key), found->second);
+    } else {
+      ASSERT_THROW(Kala.at(key), std::out_of_range);
+    }
+  }
+
+  //  changing values keeps the index, inserting and erasing drop it
+
+  int first = Reference.begin()->first;
+  Kala[first] = -1;
+  Kala.insert_or_assign(std::make_pair(first, -2));
+  ASSERT_TRUE(Kala.IsFrozen());
+  ASSERT_EQ(Kala.at(first), -2);
+
+  Kala[60000] = 1;
+  ASSERT_FALSE(Kala.IsFrozen());
+  ASSERT_EQ(Kala.at(60000), 1);
+
+  Kala.Freeze();
+  ASSERT_TRUE(Kala.contains(60000));
+  Kala.erase(Kala.FindPosition(first).first);
+  ASSERT_FALSE(Kala.IsFrozen());
+  ASSERT_FALSE(Kala.contains(first));
+
+  //  the index travels with the nodes on move and swap
+
+  Kala.Freeze();
+  Map<int, int> Moved(std::move(Kala));
+  ASSERT_TRUE(Moved.IsFrozen());
+  ASSERT_FALSE(Kala.IsFrozen());
+  ASSERT_EQ(Moved.at(60000), 1);
+  Map<int, int> Swapped;
+  Swapped.swap(Moved);
+  ASSERT_TRUE(Swapped.IsFrozen());
+  ASSERT_EQ(Swapped.at(60000), 1);
+  ASSERT_FALSE(Moved.contains(60000));
+
+  //  keys without a cache-line layout and a partly filled last node
+
+  Map<std::string, int> Words;
+  Words.Freeze();
+  ASSERT_FALSE(Words.contains("a"));
+  for (int i{0}; i < 100; i++) {
+    Words.insert(std::to_string(i * 3), i);
+  }
+  Words.Freeze();
+  for (int i{0}; i < 300; i++) {
+    ASSERT_EQ(Words.contains(std::to_string(i)),
+              Words.size() > 0 && i % 3 == 0 && i / 3 < 100);
+  }
+  ASSERT_EQ(Words.at("297"), 99);
+}
+
+//  every instruction set the CPU has ranks a node like the scalar loop,
+//  and integer maps of both widths and signs find their keys when frozen
+
+template <class Key>
+void CheckDescend(std::vector<Key> Probes) {
+  std::sort(Probes.begin(), Probes.end());
+  alignas(64) Key Line[simd::kNodeKeys<Key>];
+  for (size_t i{0}; i < simd::kNodeKeys<Key>; i++) {
+    Line[i] = static_cast<Key>(Probes[i * 2 + 1]);
+  }
+  std::vector<simd::Level> Levels{simd::Level::kScalar};
+  if (simd::kLevel != simd::Level::kScalar) {
+    Levels.push_back(simd::Level::kSse42);
+  }
+  if (simd::kLevel == simd::Level::kAvx2) {
+    Levels.push_back(simd::Level::kAvx2);
+  }
+  for (Key probe : Probes) {
+    size_t expected = simd::DescendScalar(Line, 1, probe, 99);
+    for (auto level : Levels) {
+      ASSERT_EQ(simd::Descend(Line, 1, probe, 99, level), expected);
+    }
+  }
+}
+
+template <class Key>
+void CheckFrozen(Key Lowest) {
+  Map<Key, int> Kala;
+  for (int i{0}; i < 5000; i++) {
+    Kala.insert(static_cast<Key>(Lowest + static_cast<Key>(i) * 3), i);
+  }
+  Kala.Freeze();
+  for (int i{0}; i < 15010; i++) {
+    Key key = static_cast<Key>(Lowest + static_cast<Key>(i));
+    ASSERT_EQ(Kala.contains(key), i % 3 == 0 && i < 15000);
+  }
+  ASSERT_EQ(Kala.at(static_cast<Key>(Lowest + 3 * 4999)), 4999);
+}
+
+TEST(Map, frozen_simd) {
+  std::vector<int64_t> Probes;
+  for (int64_t i{-40}; i < 40; i++) {
+    Probes.push_back(i * 1000003);
+  }
+  Probes.push_back(INT64_MIN);
+  Probes.push_back(INT64_MAX);
+  CheckDescend<int>(std::vector<int>(Probes.begin(), Probes.end() - 2));
+  CheckDescend<int64_t>(Probes);
+  CheckDescend<unsigned>(
+      std::vector<unsigned>(Probes.begin(), Probes.end() - 2));
+  CheckDescend<uint64_t>(std::vector<uint64_t>(Probes.begin(), Probes.end()));
+
+  CheckFrozen<int>(-7000);
+  CheckFrozen<int64_t>(INT64_MIN);
+  CheckFrozen<unsigned>(4294950000u);
+  CheckFrozen<uint64_t>(UINT64_MAX - 16000);
+}
+
+//  red and black rules and parent links of the tree under a map
+
+template <class Node>
+int BlackHeight(Node *node, Node *parent) {
+  if (node == nullptr) {
+    return 1;
+  }
+  EXPECT_EQ(node->_parent, parent);
+  if (node->_red) {
+    EXPECT_TRUE(node->_left == nullptr || !node->_left->_red);
+    EXPECT_TRUE(node->_right == nullptr || !node->_right->_red);
+  }
+  int left = BlackHeight(node->_left, node);
+  EXPECT_EQ(left, BlackHeight(node->_right, node));
+  return left + (node->_red ? 0 : 1);
+}
+
+template <class MapType>
+void CheckTree(MapType &map, const std::map<int, int> &Reference) {
+  ASSERT_EQ(map.size(), Reference.size());
+  if (map.empty()) {
+    return;
+  }
+  auto *root = map.begin().GetNode();
+  while (root->_parent != nullptr) {
+    root = root->_parent;
+  }
+  ASSERT_FALSE(root->_red);
+  BlackHeight(root, decltype(root){nullptr});
+  auto iter = map.begin();
+  for (auto &pair : Reference) {
+    ASSERT_EQ((*iter).first, pair.first);
+    ASSERT_EQ((*iter).second, pair.second);
+    ++iter;
+  }
+}
+
+TEST(Map, bulk_load) {
+  std::mt19937 generator(21);
+  std::uniform_int_distribution<int> keys(0, 30000);
+  std::vector<std::pair<int, int>> Batch;
+  for (int i{0}; i < 20000; i++) {
+    Batch.emplace_back(keys(generator), i);
+  }
+
+  //  unordered batch with repeated keys: the first of equal keys wins
+
+  Map<int, int> Kala(Batch.begin(), Batch.end());
+  std::map<int, int> Reference(Batch.begin(), Batch.end());
+  CheckTree(Kala, Reference);
+
+  //  merge with the present keys, then a small batch goes value by value
+
+  for (auto &pair : Batch) {
+    pair.first += 15000;
+  }
+  Kala.insert(Batch.begin(), Batch.end());
+  Reference.insert(Batch.begin(), Batch.end());
+  CheckTree(Kala, Reference);
+  std::map<int, int> Few{{-1, 1}, {7, 7}, {50000, 5}};
+  Kala.insert(Few.begin(), Few.end());
+  Reference.insert(Few.begin(), Few.end());
+  CheckTree(Kala, Reference);
+
+  //  the rebuilt tree keeps working under single inserts and erases
+
+  for (int i{0}; i < 5000; i++) {
+    int key = keys(generator);
+    if (i % 2 == 0) {
+      Kala.insert(key, i);
+      Reference.emplace(key, i);
+    } else if (Kala.contains(key)) {
+      Kala.erase(Kala.FindPosition(key).first);
+      Reference.erase(key);
+    }
+  }
+  CheckTree(Kala, Reference);
+
+  std::vector<std::pair<int, int>> Sorted(Reference.begin(), Reference.end());
+  auto Loaded = Map<int, int>::from_sorted(Sorted.begin(), Sorted.end());
+  CheckTree(Loaded, Reference);
+  std::swap(Sorted.front(), Sorted.back());
+  ASSERT_THROW((Map<int, int>::from_sorted(Sorted.begin(), Sorted.end())),
+               std::invalid_argument);
+
+  Map<int, int> Listed = {{3, 1}, {1, 2}, {3, 3}, {2, 4}};
+  CheckTree(Listed, {{1, 2}, {2, 4}, {3, 1}});
+}
+
+//  a copy that throws halfway leaves a valid tree with every key merged
+//  before it
+
+struct Fragile {
+  static inline int CopiesLeft{-1};
+  int Value;
+  Fragile(int value) : Value(value) {}
+  Fragile(const Fragile &other) : Value(other.Value) {
+    if (CopiesLeft-- == 0) {
+      throw std::runtime_error("copy");
+    }
+  }
+};
+
+TEST(Map, bulk_load_throwing_copy) {
+  Map<int, Fragile> Kala;
+  std::map<int, int> Reference;
+  for (int i{0}; i < 100; i++) {
+    Kala.insert(i * 2, Fragile(i));
+    Reference.emplace(i * 2, i);
+  }
+  std::vector<std::pair<int, Fragile>> Batch;
+  for (int i{0}; i < 100; i++) {
+    Batch.emplace_back(i * 2 + 1, Fragile(-i));
+  }
+  Fragile::CopiesLeft = 50;
+  ASSERT_THROW(Kala.insert(Batch.begin(), Batch.end()), std::runtime_error);
+  Fragile::CopiesLeft = -1;
+  for (int i{0}; i < 50; i++) {
+    Reference.emplace(i * 2 + 1, -i);
+  }
+  ASSERT_EQ(Kala.size(), Reference.size());
+  auto iter = Kala.begin();
+  for (auto &pair : Reference) {
+    ASSERT_EQ((*iter).first, pair.first);
+    ASSERT_EQ((*iter).second.Value, pair.second);
+    ++iter;
+  }
+}
+
+//  a copy of the tree that throws halfway frees the nodes it built, an
+//  assignment leaves the target empty
+
+TEST(Map, copy_throwing) {
+  Map<int, Fragile> Kala;
+  for (int i{0}; i < 100; i++) {
+    Kala.insert(i, Fragile(i));
+  }
+  Fragile::CopiesLeft = 50;
+  ASSERT_THROW((Map<int, Fragile>(Kala)), std::runtime_error);
+
+  RedBlackTree<int, Fragile> Tree, Target;
+  for (int i{0}; i < 100; i++) {
+    Tree.InsertUnique({i, Fragile(i)});
+  }
+  Target.InsertUnique({-1, Fragile(-1)});
+  Fragile::CopiesLeft = 50;
+  ASSERT_THROW(Target = Tree, std::runtime_error);
+  Fragile::CopiesLeft = -1;
+  ASSERT_EQ(Target.Size(), 0);
+  ASSERT_EQ(Target.Root(), nullptr);
+  Target.InsertUnique({1, Fragile(1)});
+  ASSERT_EQ(Target.Size(), 1);
+  ASSERT_EQ(Tree.Size(), 100);
+  ASSERT_EQ(Kala.size(), 100);
+}
+
+//  merge takes the missing keys and leaves the common ones in the source,
+//  as std::map::merge does
+
+TEST(Map, merge_against_std) {
+  std::mt19937 generator(21);
+  std::uniform_int_distribution<int> keys(0, 20000);
+  Map<int, int> Kala, Other;
+  std::map<int, int> Reference, ReferenceOther;
+  for (int i{0}; i < 10000; i++) {
+    int key = keys(generator);
+    Kala.insert(key, i);
+    Reference.emplace(key, i);
+    key = keys(generator);
+    Other.insert(key, -i);
+    ReferenceOther.emplace(key, -i);
+  }
+  Kala.Freeze();
+  Kala.merge(Other);
+  Reference.merge(ReferenceOther);
+  ASSERT_FALSE(Kala.IsFrozen());
+  CheckTree(Kala, Reference);
+  CheckTree(Other, ReferenceOther);
+
+  //  nothing left to take, then merging into an empty map and itself
+
+  Kala.merge(Other);
+  CheckTree(Other, ReferenceOther);
+  Map<int, int> Empty;
+  Empty.merge(Kala);
+  ASSERT_TRUE(Kala.empty());
+  Empty.merge(Empty);
+  CheckTree(Empty, Reference);
+}
+
+TEST(Map, merge_other_resource) {
+  std::pmr::monotonic_buffer_resource Resource, OtherResource;
+  s21::pmr::Map<int, std::string> Kala(&Resource), Other(&OtherResource);
+  for (int i{0}; i < 1000; i++) {
+    Kala.insert(i * 2, std::to_string(i));
+    Other.insert(i * 3, std::string(20, 'a'));
+  }
+  Kala.merge(Other);
+  ASSERT_EQ(Kala.size(), 1000 + 666);
+  ASSERT_EQ(Other.size(), 334);
+  ASSERT_EQ(Kala.at(3), std::string(20, 'a'));
+  ASSERT_EQ(Kala.at(6), "3");
+  ASSERT_EQ(Other.at(6), std::string(20, 'a'));
+  ASSERT_EQ(Kala.get_allocator().resource(), &Resource);
+}
+
+//  a move assignment takes the nodes over instead of copying them
+
+TEST(Map, move_assign_steals) {
+  static_assert(std::is_nothrow_move_constructible_v<Map<int, std::string>>);
+  static_assert(std::is_nothrow_move_assignable_v<Map<int, std::string>>);
+  static_assert(is_trivially_relocatable_v<Map<int, std::string>>);
+
+  Map<int, std::string> Kala, Other;
+  for (int i{0}; i < 1000; i++) {
+    Kala.insert(i, std::to_string(i));
+  }
+  Kala.Freeze();
+  std::string *Stored{&Kala.at(500)};
+
+  Other.insert(-1, "gone");
+  Other = std::move(Kala);
+  ASSERT_TRUE(Kala.empty());
+  ASSERT_FALSE(Other.IsFrozen());
+  ASSERT_EQ(Other.size(), 1000);
+  ASSERT_EQ(&Other.at(500), Stored);
+  ASSERT_FALSE(Other.contains(-1));
+
+  Kala.insert(1, "back");
+  ASSERT_EQ(Kala.at(1), "back");
+
+  //  over another resource the values are copied into nodes of our own
+  std::pmr::monotonic_buffer_resource Resource, OtherResource;
+  s21::pmr::Map<int, std::string> Here(&Resource), There(&OtherResource);
+  There.insert(1, "one");
+  Here = std::move(There);
+  ASSERT_EQ(Here.at(1), "one");
+  ASSERT_EQ(Here.get_allocator().resource(), &Resource);
+  ASSERT_TRUE(There.empty());
+}
+
 int main() {
   testing::InitGoogleTest();
   return RUN_ALL_TESTS();
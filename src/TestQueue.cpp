@@ -4,11 +4,20 @@
 
 #include <gtest/gtest.h>
 
+#include <memory_resource>
+#include <queue>
+#include <stdexcept>
+#include <string>
+
 #include "containerAdaptor.h"
+#include "list.h"
 
 using namespace s21;
 
 TEST(Queue, basic) {
+  static_assert(std::is_nothrow_move_constructible_v<Queue<std::string>>);
+  static_assert(is_trivially_relocatable_v<Queue<std::string>>);
+
   Queue<int> Kala;
   int k = 5;
 
@@ -124,6 +133,124 @@ TEST(Queue, basic) {
   ASSERT_EQ(1, Moved.front());
 }
 
+TEST(Queue, ring_buffer) {
+  Queue<std::string> Kala;
+  std::queue<std::string> Reference;
+
+  //  Interleaved push/pop wraps Head around the buffer and grows it while
+  //  the elements are split between the end and the start of the store
+
+  for (int i{0}; i < 1000; i++) {
+    Kala.push(std::to_string(i));
+    Reference.push(std::to_string(i));
+    if (i % 3 == 2) {
+      ASSERT_EQ(Kala.front(), Reference.front());
+      Kala.pop();
+      Reference.pop();
+    }
+    ASSERT_EQ(Kala.size(), Reference.size());
+    ASSERT_EQ(Kala.back(), Reference.back());
+  }
+
+  ASSERT_EQ(Kala.capacity() & (Kala.capacity() - 1), 0);
+  ASSERT_GE(Kala.capacity(), Kala.size());
+
+  Queue<std::string> KalaCopied(Kala);
+
+  while (!Reference.empty()) {
+    ASSERT_EQ(Kala.front(), Reference.front());
+    ASSERT_EQ(KalaCopied.front(), Reference.front());
+    Kala.pop();
+    KalaCopied.pop();
+    Reference.pop();
+  }
+
+  ASSERT_TRUE(Kala.empty());
+  ASSERT_THROW(Kala.pop(), std::out_of_range);
+  ASSERT_THROW(Kala.front(), std::out_of_range);
+}
+
+//  a copy of the ring buffer that throws halfway frees what it built
+
+struct Fragile {
+  static inline int CopiesLeft{-1};
+  std::string Value;
+  Fragile(int value) : Value(std::to_string(value)) {}
+  Fragile(const Fragile &other) : Value(other.Value) {
+    if (CopiesLeft-- == 0) {
+      throw std::runtime_error("copy");
+    }
+  }
+};
+
+TEST(Queue, copy_throwing) {
+  Queue<Fragile> Kala;
+  for (int i{0}; i < 100; i++) {
+    Kala.emplace(i);
+  }
+  Fragile::CopiesLeft = 50;
+  ASSERT_THROW(Queue<Fragile>{Kala}, std::runtime_error);
+  Fragile::CopiesLeft = -1;
+  ASSERT_EQ(Kala.size(), 100);
+  ASSERT_EQ(Kala.back().Value, "99");
+}
+
+TEST(Queue, pmr_monotonic_buffer) {
+  std::byte Buffer[16 * 1024];
+  std::pmr::monotonic_buffer_resource Resource(Buffer, sizeof(Buffer),
+                                               std::pmr::null_memory_resource());
+  s21::pmr::Queue<int> Kala(&Resource);
+  for (int i{0}; i < 1000; i++) {
+    Kala.push(i);
+  }
+  ASSERT_EQ(Kala.size(), 1000);
+  ASSERT_EQ(Kala.capacity(), 1024);
+  ASSERT_EQ(Kala.get_allocator().resource(), &Resource);
+
+  //  a queue over another resource takes the elements, not the store
+  std::pmr::unsynchronized_pool_resource OtherResource;
+  s21::pmr::Queue<int> Other(&OtherResource);
+  Other = std::move(Kala);
+  ASSERT_EQ(Other.get_allocator().resource(), &OtherResource);
+  for (int i{0}; i < 1000; i++) {
+    ASSERT_EQ(Other.front(), i);
+    Other.pop();
+  }
+}
+
+TEST(Queue, list_container) {
+  Queue<std::string, List<std::string>> Kala = {"zero"};
+  std::queue<std::string> Reference;
+  Reference.push("zero");
+
+  for (int i{0}; i < 1000; i++) {
+    Kala.push(std::to_string(i));
+    Reference.push(std::to_string(i));
+    if (i % 3 == 2) {
+      ASSERT_EQ(Kala.front(), Reference.front());
+      Kala.pop();
+      Reference.pop();
+    }
+    ASSERT_EQ(Kala.size(), Reference.size());
+    ASSERT_EQ(Kala.back(), Reference.back());
+  }
+
+  std::string *Emplaced{&Kala.emplace("emplaced")};
+  ASSERT_EQ(Emplaced, &Kala.back());
+  Reference.emplace("emplaced");
+
+  //  List keeps each element at its address while others come and go
+
+  std::string *Back{&Kala.back()};
+  Kala.push("last");
+  Kala.pop();
+  ASSERT_EQ(Back, &*(--(--Kala.GetContainer().end())));
+
+  Kala.clear();
+  ASSERT_TRUE(Kala.empty());
+  ASSERT_THROW(Kala.front(), std::out_of_range);
+}
+
 int main() {
   testing::InitGoogleTest();
   return RUN_ALL_TESTS();
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "smallVector.h"
+
+using namespace s21;
+
+TEST(SmallVector, basic) {
+  SmallVector<int, 4> Kala;
+
+  ASSERT_TRUE(Kala.empty());
+  ASSERT_TRUE(Kala.IsInline());
+  ASSERT_EQ(Kala.capacity(), 4);
+  ASSERT_THROW(Kala.pop_back(), std::out_of_range);
+
+  //  inline while it fits
+
+  for (int i{0}; i < 4; i++) {
+    Kala.push_back(i);
+  }
+
+  ASSERT_TRUE(Kala.IsInline());
+  ASSERT_EQ(Kala.size(), 4);
+  ASSERT_EQ(Kala.front(), 0);
+  ASSERT_EQ(Kala.back(), 3);
+
+  //  spills to the heap past N
+
+  Kala.push_back(4);
+
+  ASSERT_FALSE(Kala.IsInline());
+  ASSERT_EQ(Kala.capacity(), 8);
+  ASSERT_EQ(Kala.at(4), 4);
+  ASSERT_THROW(Kala.at(5), std::out_of_range);
+
+  //  insert, erase and iterators work as in Vector
+
+  Kala.insert(Kala.begin() + 2, -1);
+  Kala.erase(Kala.begin());
+
+  ASSERT_EQ(Kala.size(), 5);
+  ASSERT_EQ(Kala[0], 1);
+  ASSERT_EQ(Kala[1], -1);
+  ASSERT_EQ(Kala.end() - Kala.begin(), 5);
+
+  std::ranges::sort(Kala);
+
+  ASSERT_EQ(Kala.front(), -1);
+  ASSERT_EQ(Kala.back(), 4);
+
+  //  back to the inline buffer once it fits again
+
+  Kala.pop_back();
+  Kala.pop_back();
+  Kala.shrink_to_fit();
+
+  ASSERT_TRUE(Kala.IsInline());
+  ASSERT_EQ(Kala.capacity(), 4);
+  ASSERT_EQ(Kala.size(), 3);
+  ASSERT_EQ(Kala.back(), 2);
+
+  Kala.reserve(20);
+
+  ASSERT_FALSE(Kala.IsInline());
+  ASSERT_EQ(Kala.capacity(), 20);
+
+  Kala.clear();
+
+  ASSERT_TRUE(Kala.IsInline());
+  ASSERT_EQ(Kala.size(), 0);
+  ASSERT_EQ(Kala.capacity(), 4);
+}
+
+//  the inline buffer is inside the object: a move copies it, never throws
+//  for such elements, and the bytes cannot simply be relocated
+
+TEST(SmallVector, copy_move_swap) {
+  static_assert(std::is_nothrow_move_constructible_v<SmallVector<int, 4>>);
+  static_assert(!is_trivially_relocatable_v<SmallVector<std::string, 4>>);
+
+  SmallVector<std::string, 2> Small = {"one", "two"};
+  SmallVector<std::string, 2> Large = {"a", "b", "c", "d"};
+
+  ASSERT_TRUE(Small.IsInline());
+  ASSERT_FALSE(Large.IsInline());
+
+  SmallVector<std::string, 2> SmallCopied(Small);
+  SmallVector<std::string, 2> LargeCopied(Large);
+
+  ASSERT_TRUE(SmallCopied.IsInline());
+  ASSERT_EQ(SmallCopied.back(), "two");
+  ASSERT_EQ(LargeCopied.size(), 4);
+  ASSERT_EQ(LargeCopied.back(), "d");
+
+  //  an inline vector relocates its elements, a heap one hands its store over
+
+  SmallVector<std::string, 2> SmallMoved(std::move(Small));
+  const std::string *LargeStore{Large.data()};
+  SmallVector<std::string, 2> LargeMoved(std::move(Large));
+
+  ASSERT_TRUE(Small.empty());
+  ASSERT_TRUE(Large.empty());
+  ASSERT_TRUE(Large.IsInline());
+  ASSERT_EQ(SmallMoved.front(), "one");
+  ASSERT_EQ(LargeMoved.data(), LargeStore);
+
+  SmallMoved.swap(LargeMoved);
+
+  ASSERT_EQ(SmallMoved.size(), 4);
+  ASSERT_EQ(SmallMoved.data(), LargeStore);
+  ASSERT_EQ(LargeMoved.size(), 2);
+  ASSERT_TRUE(LargeMoved.IsInline());
+  ASSERT_EQ(LargeMoved.back(), "two");
+
+  SmallCopied = std::move(SmallMoved);
+
+  ASSERT_EQ(SmallCopied.size(), 4);
+  ASSERT_EQ(SmallCopied.front(), "a");
+  ASSERT_TRUE(SmallMoved.empty());
+
+  auto iter = SmallCopied.emplace(SmallCopied.begin() + 1, 3, 'z');
+
+  ASSERT_EQ(*iter, "zzz");
+  ASSERT_EQ(SmallCopied[2], "b");
+}
+
+//  while within N nothing is allocated: the upstream resource refuses all
+
+TEST(SmallVector, no_allocation_inline) {
+  pmr::SmallVector<int, 16> Kala(std::pmr::null_memory_resource());
+
+  for (int i{0}; i < 16; i++) {
+    Kala.push_back(i);
+  }
+  Kala.erase(Kala.begin());
+  Kala.insert(Kala.begin(), 100);
+
+  ASSERT_EQ(Kala.size(), 16);
+  ASSERT_EQ(Kala.front(), 100);
+  ASSERT_THROW(Kala.push_back(16), std::bad_alloc);
+  ASSERT_EQ(Kala.size(), 16);
+  ASSERT_TRUE(Kala.IsInline());
+}
+
+TEST(SmallVector, against_std) {
+  SmallVector<int, 8> Kala;
+  std::vector<int> Reference;
+
+  for (int i{0}; i < 1000; i++) {
+    int value{i * 37 % 101};
+    if (value % 5 == 0 && !Reference.empty()) {
+      size_t position = value % Reference.size();
+      Kala.erase(Kala.begin() + position);
+      Reference.erase(Reference.begin() + position);
+    } else if (value % 3 == 0) {
+      size_t position = value % (Reference.size() + 1);
+      Kala.insert(Kala.begin() + position, value);
+      Reference.insert(Reference.begin() + position, value);
+    } else {
+      Kala.push_back(value);
+      Reference.push_back(value);
+    }
+    ASSERT_EQ(Kala.size(), Reference.size());
+  }
+  ASSERT_TRUE(std::equal(Kala.begin(), Kala.end(), Reference.begin()));
+}
+
+int main() {
+  testing::InitGoogleTest();
+  return RUN_ALL_TESTS();
+}
@@ -4,11 +4,19 @@
 
 #include <gtest/gtest.h>
 
+#include <memory>
+#include <memory_resource>
+#include <string>
+
 #include "containerAdaptor.h"
+#include "list.h"
+#include "smallVector.h"
 
 using namespace s21;
 
 TEST(Stack, basic) {
+  static_assert(std::is_nothrow_move_assignable_v<Stack<std::string>>);
+
   Stack<int> Kala;
   int k = 5;
 
@@ -108,6 +116,129 @@ TEST(Stack, basic) {
   ASSERT_EQ(4, Moved.top());
 }
 
+TEST(Stack, pmr_monotonic_buffer) {
+  std::byte Buffer[16 * 1024];
+  std::pmr::monotonic_buffer_resource Resource(Buffer, sizeof(Buffer),
+                                               std::pmr::null_memory_resource());
+  s21::pmr::Stack<int> Kala(&Resource);
+  for (int i{0}; i < 50; i++) {
+    Kala.push(i);
+  }
+  ASSERT_EQ(50, Kala.size());
+  ASSERT_EQ(49, Kala.top());
+  ASSERT_EQ(&Resource, Kala.get_allocator().resource());
+  Kala.pop();
+  ASSERT_EQ(48, Kala.top());
+}
+
+TEST(Stack, capacity) {
+  Stack<int> Kala;
+
+  //  capacity doubles, a pop keeps it for the next pushes
+
+  for (int i{0}; i < 100; i++) {
+    Kala.push(i);
+  }
+  ASSERT_EQ(100, Kala.size());
+  ASSERT_EQ(128, Kala.capacity());
+
+  for (int i{99}; i >= 50; i--) {
+    ASSERT_EQ(i, Kala.top());
+    Kala.pop();
+  }
+  ASSERT_EQ(128, Kala.capacity());
+
+  Kala.shrink_to_fit();
+  ASSERT_EQ(50, Kala.capacity());
+  ASSERT_EQ(49, Kala.top());
+
+  Kala.reserve(1000);
+  ASSERT_EQ(1000, Kala.capacity());
+  Kala.reserve(10);
+  ASSERT_EQ(1000, Kala.capacity());
+  ASSERT_EQ(50, Kala.size());
+
+  //  a reference to the top survives as the argument of a growing push
+
+  Kala.shrink_to_fit();
+  Kala.push(Kala.top());
+  ASSERT_EQ(49, Kala.top());
+  ASSERT_EQ(51, Kala.size());
+
+  Kala.clear();
+  ASSERT_TRUE(Kala.empty());
+  ASSERT_THROW(Kala.pop(), std::out_of_range);
+}
+
+TEST(Stack, emplace) {
+  Stack<std::string> Strings;
+
+  ASSERT_EQ("aaa", Strings.emplace(3, 'a'));
+  Strings.emplace("bb");
+  Strings.push(std::string(40, 'c'));
+
+  ASSERT_EQ(3, Strings.size());
+  ASSERT_EQ(std::string(40, 'c'), Strings.top());
+  Strings.pop();
+  ASSERT_EQ("bb", Strings.top());
+
+  Stack<std::string> Copied(Strings);
+  Strings.pop();
+  ASSERT_EQ("bb", Copied.top());
+  ASSERT_EQ("aaa", Strings.top());
+
+  //  move-only elements
+
+  Stack<std::unique_ptr<int>> Pointers;
+  for (int i{0}; i < 20; i++) {
+    Pointers.emplace(new int(i));
+  }
+  Pointers.push(std::make_unique<int>(20));
+  ASSERT_EQ(20, *Pointers.top());
+  Pointers.pop();
+  ASSERT_EQ(19, *Pointers.top());
+
+  Stack<std::unique_ptr<int>> Moved;
+  Moved = std::move(Pointers);
+  ASSERT_EQ(20, Moved.size());
+  ASSERT_TRUE(Pointers.empty());
+}
+
+//  the same stack over other containers
+
+template <typename StackType>
+void CheckContainer() {
+  StackType Kala = {1, 2, 3};
+  for (int i{4}; i <= 100; i++) {
+    Kala.push(i);
+  }
+  ASSERT_EQ(100, Kala.size());
+  ASSERT_EQ(101, Kala.emplace(101));
+  Kala.pop();
+
+  StackType Copied(Kala);
+  for (int i{100}; i > 0; i--) {
+    ASSERT_EQ(i, Kala.top());
+    Kala.pop();
+  }
+  ASSERT_TRUE(Kala.empty());
+  ASSERT_THROW(Kala.top(), std::out_of_range);
+  ASSERT_THROW(Kala.pop(), std::out_of_range);
+
+  Copied.top() = -1;
+  ASSERT_EQ(-1, Copied.top());
+  Kala.swap(Copied);
+  ASSERT_EQ(100, Kala.size());
+  ASSERT_TRUE(Copied.empty());
+}
+
+TEST(Stack, containers) {
+  CheckContainer<Stack<int>>();
+  CheckContainer<Stack<int, List<int>>>();
+  CheckContainer<Stack<int, SmallVector<int, 16>>>();
+  CheckContainer<Stack<int, RingBuffer<int>>>();
+}
+
 int main() {
   testing::InitGoogleTest();
   return RUN_ALL_TESTS();
@@ -0,0 +1,243 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <memory_resource>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include "unorderedMap.h"
+
+using namespace s21;
+
+TEST(UnorderedMap, basic) {
+  UnorderedMap<int, int> Kala;
+
+  ASSERT_TRUE(Kala.empty());
+  ASSERT_EQ(Kala.size(), 0);
+  ASSERT_FALSE(Kala.contains(1));
+  ASSERT_EQ(Kala.find(1), Kala.end());
+  ASSERT_EQ(Kala.begin(), Kala.end());
+  ASSERT_THROW(Kala.at(1), std::out_of_range);
+  ASSERT_EQ(Kala.erase(1), 0);
+
+  auto inserted = Kala.insert(std::make_pair(15, 6));
+  ASSERT_TRUE(inserted.second);
+  ASSERT_EQ(inserted.first->first, 15);
+  ASSERT_FALSE(Kala.insert(15, 7).second);
+  ASSERT_EQ(Kala.at(15), 6);
+
+  auto assigned = Kala.insert_or_assign(std::make_pair(15, 8));
+  ASSERT_FALSE(assigned.second);
+  ASSERT_EQ(Kala.at(15), 8);
+  ASSERT_TRUE(Kala.insert_or_assign(std::make_pair(1, 2)).second);
+
+  Kala[3] = 93;
+  ASSERT_EQ(Kala[3], 93);
+  ASSERT_EQ(Kala[4], 0);
+  ASSERT_EQ(Kala.size(), 4);
+  ASSERT_TRUE(Kala.contains(4));
+
+  ASSERT_EQ(Kala.erase(4), 1);
+  Kala.erase(Kala.find(1));
+  ASSERT_EQ(Kala.size(), 2);
+  ASSERT_FALSE(Kala.contains(1));
+  ASSERT_TRUE(Kala.contains(3));
+
+  int sum{0};
+  for (auto &pair : Kala) {
+    sum += pair.second;
+  }
+  ASSERT_EQ(sum, 8 + 93);
+
+  Kala.clear();
+  ASSERT_TRUE(Kala.empty());
+  ASSERT_EQ(Kala.begin(), Kala.end());
+  Kala.insert(5, 5);
+  ASSERT_EQ(Kala.at(5), 5);
+}
+
+//  random inserts and erases leave tombstones behind, the table keeps
+//  finding every key through rehashes and cleanups
+
+TEST(UnorderedMap, against_std) {
+  UnorderedMap<int, int> Kala;
+  std::unordered_map<int, int> Reference;
+  std::mt19937 generator(21);
+  std::uniform_int_distribution<int> keys(0, 5000);
+
+  for (int i{0}; i < 100000; i++) {
+    int key = keys(generator);
+    if (i % 3 == 0) {
+      ASSERT_EQ(Kala.erase(key), Reference.erase(key));
+    } else if (i % 3 == 1) {
+      ASSERT_EQ(Kala.insert(key, i).second,
+                Reference.emplace(key, i).second);
+    } else {
+      ASSERT_EQ(Kala.contains(key), Reference.count(key) == 1);
+    }
+    ASSERT_EQ(Kala.size(), Reference.size());
+  }
+  ASSERT_LE(Kala.load_factor(), 0.875f);
+  for (auto &pair : Reference) {
+    ASSERT_EQ(Kala.at(pair.first), pair.second);
+  }
+  size_t count{0};
+  for (auto &pair : Kala) {
+    ASSERT_EQ(Reference.at(pair.first), pair.second);
+    count++;
+  }
+  ASSERT_EQ(count, Reference.size());
+}
+
+//  string keys and values that only move, copies and moves of the table
+
+TEST(UnorderedMap, strings_copy_move) {
+  static_assert(
+      std::is_nothrow_move_constructible_v<UnorderedMap<int, std::string>>);
+  static_assert(
+      std::is_nothrow_move_assignable_v<UnorderedMap<int, std::string>>);
+  static_assert(is_trivially_relocatable_v<UnorderedMap<int, std::string>>);
+
+  UnorderedMap<std::string, std::unique_ptr<int>> Pointers;
+  for (int i{0}; i < 1000; i++) {
+    Pointers.try_emplace(std::to_string(i), new int(i));
+  }
+  Pointers.reserve(5000);
+  ASSERT_GE(Pointers.bucket_count() * 7 / 8, 5000);
+  ASSERT_EQ(*Pointers.at("999"), 999);
+
+  UnorderedMap<std::string, std::unique_ptr<int>> Moved(std::move(Pointers));
+  ASSERT_TRUE(Pointers.empty());
+  ASSERT_EQ(*Moved["500"], 500);
+  Pointers = std::move(Moved);
+  ASSERT_EQ(Pointers.size(), 1000);
+  ASSERT_TRUE(Moved.empty());
+
+  UnorderedMap<std::string, int> Words = {{"one", 1}, {"two", 2}};
+  UnorderedMap<std::string, int> Copied(Words);
+  Copied["three"] = 3;
+  ASSERT_EQ(Words.size(), 2);
+  ASSERT_FALSE(Words.contains("three"));
+
+  Words.swap(Copied);
+  ASSERT_EQ(Words.size(), 3);
+  ASSERT_EQ(Copied.at("two"), 2);
+
+  const UnorderedMap<std::string, int> &Constant{Words};
+  ASSERT_EQ(Constant.find("three")->second, 3);
+  ASSERT_EQ(Constant.find("four"), Constant.end());
+}
+
+TEST(UnorderedMap, pmr_monotonic_buffer) {
+  std::pmr::monotonic_buffer_resource Resource;
+  pmr::UnorderedMap<int, int> Kala(&Resource);
+  for (int i{0}; i < 10000; i++) {
+    Kala[i] = i;
+  }
+  ASSERT_EQ(Kala.get_allocator().resource(), &Resource);
+
+  //  a map over another resource takes the elements, not the store
+
+  std::pmr::unsynchronized_pool_resource OtherResource;
+  pmr::UnorderedMap<int, int> Other(&OtherResource);
+  Other = std::move(Kala);
+  ASSERT_EQ(Other.get_allocator().resource(), &OtherResource);
+  ASSERT_EQ(Other.size(), 10000);
+  ASSERT_EQ(Other.at(9999), 9999);
+  ASSERT_TRUE(Kala.empty());
+}
+
+//  every default constructed hasher draws its own seed, so a table only
+//  finds what its own hasher placed
+
+struct SeededHash {
+  static inline size_t NextSeed{1};
+  size_t Seed{NextSeed++ * 0x9e3779b97f4a7c15};
+  size_t operator()(int key) const {
+    return std::hash<int>()(key) * Seed;
+  }
+};
+
+TEST(UnorderedMap, move_other_resource_stateful_hash) {
+  std::pmr::monotonic_buffer_resource Resource;
+  std::pmr::unsynchronized_pool_resource OtherResource;
+  pmr::UnorderedMap<int, int, SeededHash> Kala(&Resource);
+  pmr::UnorderedMap<int, int, SeededHash> Other(&OtherResource);
+  for (int i{0}; i < 1000; i++) {
+    Kala[i] = -i;
+  }
+  Other = std::move(Kala);
+  ASSERT_EQ(Other.size(), 1000);
+  for (int i{0}; i < 1000; i++) {
+    ASSERT_NE(Other.find(i), Other.end());
+    ASSERT_EQ(Other.at(i), -i);
+  }
+}
+
+//  a rehash moves the keys instead of copying them and builds no functors
+//  of its own
+
+struct CountedKey {
+  static inline int Copies{0};
+  int Value;
+  CountedKey(int value) : Value(value) {}
+  CountedKey(const CountedKey &other) : Value(other.Value) {Copies++;}
+  CountedKey(CountedKey &&other) noexcept : Value(other.Value) {}
+  bool operator==(const CountedKey &other) const {
+    return Value == other.Value;
+  }
+};
+
+struct OffsetHash {
+  explicit OffsetHash(size_t offset) : Offset(offset) {}
+  size_t Offset;
+  size_t operator()(const CountedKey &key) const {
+    return std::hash<int>()(key.Value) + Offset;
+  }
+};
+
+TEST(UnorderedMap, rehash_moves_keys) {
+  UnorderedMap<CountedKey, std::string, OffsetHash> Kala(0, OffsetHash(7));
+  CountedKey::Copies = 0;
+  for (int i{0}; i < 1000; i++) {
+    Kala.try_emplace(i, std::to_string(i));
+  }
+  ASSERT_EQ(CountedKey::Copies, 1000);
+  ASSERT_EQ(Kala.at(999), "999");
+
+  UnorderedMap<CountedKey, std::string, OffsetHash> Copied(Kala);
+  ASSERT_EQ(Copied.size(), 1000);
+  ASSERT_EQ(Copied.at(500), "500");
+  Copied.reserve(10000);
+  ASSERT_EQ(Copied.at(0), "0");
+}
+
+struct Fragile {
+  static inline int CopiesLeft{-1};
+  std::string Value;
+  Fragile(int value) : Value(std::to_string(value)) {}
+  Fragile(const Fragile &other) : Value(other.Value) {
+    if (CopiesLeft-- == 0) {
+      throw std::runtime_error("copy");
+    }
+  }
+};
+
+TEST(UnorderedMap, copy_throwing) {
+  UnorderedMap<int, Fragile> Kala;
+  for (int i{0}; i < 1000; i++) {
+    Kala.try_emplace(i, i);
+  }
+  Fragile::CopiesLeft = 500;
+  ASSERT_THROW((UnorderedMap<int, Fragile>(Kala)), std::runtime_error);
+  Fragile::CopiesLeft = -1;
+  UnorderedMap<int, Fragile> Copied(Kala);
+  ASSERT_EQ(Copied.at(999).Value, "999");
+}
+
+int main() {
+  testing::InitGoogleTest();
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,262 @@
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <list>
+#include <memory_resource>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "unrolledList.h"
+using namespace s21;
+
+template <typename ListType>
+auto Values(ListType& list) {
+  std::vector<typename ListType::value_type> values;
+  for (auto iter = list.begin(); iter != list.end(); ++iter) {
+    values.push_back(*iter);
+  }
+  return values;
+}
+
+TEST(UnrolledList, basic) {
+  static_assert(std::bidirectional_iterator<UnrolledList<int>::iterator>);
+  static_assert(std::is_nothrow_move_constructible_v<UnrolledList<int>>);
+  static_assert(std::is_nothrow_move_assignable_v<UnrolledList<int>>);
+  static_assert(UnrolledList<int>::NodeCapacity == 26);
+
+  UnrolledList<int> empty;
+  ASSERT_TRUE(empty.empty());
+  ASSERT_TRUE(empty.begin() == empty.end());
+  empty.pop_back();
+  empty.pop_front();
+  ASSERT_THROW(empty.erase(empty.end()), std::out_of_range);
+
+  UnrolledList<int> numbers;
+  for (int i = 0; i < 100; i++) {
+    numbers.push_back(i);
+  }
+  numbers.push_front(-1);
+  ASSERT_EQ(numbers.size(), 101);
+  ASSERT_EQ(numbers.front(), -1);
+  ASSERT_EQ(numbers.back(), 99);
+  ASSERT_EQ(*(numbers.begin() + 50), 49);
+  ASSERT_EQ(*(numbers.end() - 1), 99);
+  ASSERT_EQ(*(numbers.end() - 101), -1);
+  ASSERT_TRUE(numbers.begin() + 101 == numbers.end());
+  ASSERT_TRUE((numbers.begin() + 60) - 60 == numbers.begin());
+
+  int expected = 99;
+  for (auto iter = numbers.end(); iter != numbers.begin();) {
+    --iter;
+    ASSERT_EQ(*iter, expected--);
+  }
+
+  numbers.pop_front();
+  numbers.pop_back();
+  auto iter = numbers.insert(numbers.begin() + 30, 1000);
+  ASSERT_EQ(*iter, 1000);
+  ASSERT_EQ(*++iter, 30);
+  numbers.erase(numbers.begin() + 30);
+  std::vector<int> reference(99);
+  for (int i = 0; i < 99; i++) reference[i] = i;
+  ASSERT_EQ(Values(numbers), reference);
+
+  numbers.clear();
+  ASSERT_TRUE(numbers.empty());
+  ASSERT_EQ(numbers.emplace_back(1), 1);
+  numbers.emplace_back(2);
+  ASSERT_EQ(numbers.emplace_front(0), 0);
+  ASSERT_EQ(*numbers.emplace(numbers.begin() + 1, 7), 7);
+  ASSERT_EQ(Values(numbers), std::vector<int>({0, 7, 1, 2}));
+
+  // one element is built in place from the arguments
+  UnrolledList<std::string> strings;
+  strings.emplace_back(3, 'x');
+  strings.emplace(strings.begin(), "abc", 2);
+  ASSERT_EQ(Values(strings), std::vector<std::string>({"ab", "xxx"}));
+}
+
+// random inserts and erases anywhere split and merge nodes at every
+// position; strings make leaks and double moves visible to the sanitizers
+TEST(UnrolledList, against_std) {
+  std::mt19937 generator(24);
+  UnrolledList<std::string> strings;
+  std::list<std::string> reference;
+  for (int i = 0; i < 20000; i++) {
+    size_t position = generator() % (reference.size() + 1);
+    std::string value = "value number " + std::to_string(i);
+    auto mirror = std::next(reference.begin(), position);
+    switch (generator() % 6) {
+      case 0:
+      case 1:
+        strings.insert(strings.begin() + position, value);
+        reference.insert(mirror, value);
+        break;
+      case 2:
+        if (mirror != reference.end()) {
+          strings.erase(strings.begin() + position);
+          reference.erase(mirror);
+        }
+        break;
+      case 3:
+        strings.push_back(value);
+        reference.push_back(value);
+        break;
+      case 4:
+        strings.pop_front();
+        if (!reference.empty()) reference.pop_front();
+        break;
+      default:
+        // inserts a copy of an element of the list itself
+        if (mirror != reference.end()) {
+          strings.insert(strings.begin() + position,
+                         *(strings.begin() + position));
+          reference.insert(mirror, *mirror);
+        }
+    }
+    ASSERT_EQ(strings.size(), reference.size());
+  }
+  ASSERT_EQ(Values(strings),
+            std::vector<std::string>(reference.begin(), reference.end()));
+}
+
+TEST(UnrolledList, algorithms) {
+  std::mt19937 generator(7);
+  typedef std::vector<std::pair<int, int>> Pairs;
+  UnrolledList<std::pair<int, int>> pairs;
+  std::list<std::pair<int, int>> reference;
+  for (int i = 0; i < 500; i++) {
+    std::pair<int, int> value(generator() % 50, i);
+    pairs.push_back(value);
+    reference.push_back(value);
+  }
+  auto by_key = [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+    return a.first < b.first;
+  };
+  pairs.sort(by_key);
+  reference.sort(by_key);
+  ASSERT_EQ(Values(pairs), Pairs(reference.begin(), reference.end()));
+
+  // a comparison that throws leaves the list as it was
+  UnrolledList<std::pair<int, int>> shuffled;
+  for (int i = 0; i < 500; i++) {
+    shuffled.push_back({static_cast<int>(generator() % 50), i});
+  }
+  Pairs before = Values(shuffled);
+  int calls = 0;
+  ASSERT_THROW(shuffled.sort([&calls](const std::pair<int, int>& a,
+                                      const std::pair<int, int>& b) {
+    if (++calls == 1000) throw std::runtime_error("compare");
+    return a.first < b.first;
+  }),
+               std::runtime_error);
+  ASSERT_EQ(Values(shuffled), before);
+
+  // of equal keys the ones of this list come first
+  UnrolledList<std::pair<int, int>> other;
+  std::list<std::pair<int, int>> other_reference;
+  for (int i = 0; i < 100; i++) {
+    other.push_back({i, -i});
+    other_reference.push_back({i, -i});
+  }
+  pairs.merge(other, by_key);
+  reference.merge(other_reference, by_key);
+  ASSERT_TRUE(other.empty());
+  ASSERT_EQ(Values(pairs), Pairs(reference.begin(), reference.end()));
+
+  UnrolledList<int> numbers = {1, 1, 2, 3, 3, 3, 4, 1, 1};
+  numbers.unique();
+  ASSERT_EQ(Values(numbers), std::vector<int>({1, 2, 3, 4, 1}));
+  numbers.reverse();
+  ASSERT_EQ(Values(numbers), std::vector<int>({1, 4, 3, 2, 1}));
+
+  // a splice into the middle of a node splits it
+  UnrolledList<int> many, inserted = {-1, -2, -3};
+  for (int i = 0; i < 100; i++) many.push_back(i);
+  many.splice(many.begin() + 10, inserted);
+  ASSERT_TRUE(inserted.empty());
+  ASSERT_EQ(many.size(), 103);
+  ASSERT_EQ(*(many.begin() + 9), 9);
+  ASSERT_EQ(*(many.begin() + 10), -1);
+  ASSERT_EQ(*(many.begin() + 13), 10);
+
+  // single elements, within one list and between two
+  many.splice(many.begin(), many, many.begin() + 11);
+  ASSERT_EQ(many.front(), -2);
+  many.splice(many.end(), many, many.begin());
+  ASSERT_EQ(many.back(), -2);
+  ASSERT_EQ(*(many.begin() + 10), -1);
+  inserted.splice(inserted.begin(), many, many.begin());
+  ASSERT_EQ(Values(inserted), std::vector<int>({0}));
+  ASSERT_EQ(many.size(), 102);
+}
+
+TEST(UnrolledList, copy_move_pmr) {
+  UnrolledList<std::string> strings;
+  for (int i = 0; i < 100; i++) {
+    strings.push_back(std::to_string(i));
+  }
+  UnrolledList<std::string> copied(strings);
+  ASSERT_EQ(Values(copied), Values(strings));
+
+  std::string* first = &strings.front();
+  UnrolledList<std::string> moved(std::move(strings));
+  ASSERT_TRUE(strings.empty());
+  ASSERT_EQ(&moved.front(), first);
+  strings.swap(moved);
+  ASSERT_EQ(&strings.front(), first);
+  ASSERT_TRUE(moved.empty());
+  moved = std::move(copied);
+  ASSERT_EQ(moved.size(), 100);
+  ASSERT_EQ(moved.back(), "99");
+
+  std::byte buffer[16 * 1024];
+  std::pmr::monotonic_buffer_resource resource(
+      buffer, sizeof(buffer), std::pmr::null_memory_resource());
+  s21::pmr::UnrolledList<int> list(&resource);
+  for (int i = 0; i < 1000; i++) {
+    list.push_back(i);
+  }
+  ASSERT_EQ(*(list.begin() + 500), 500);
+  ASSERT_EQ(list.get_allocator().resource(), &resource);
+
+  // other allocators are not equal: the values are moved, not the nodes
+  std::pmr::monotonic_buffer_resource other_resource;
+  s21::pmr::UnrolledList<int> other(&other_resource);
+  other = std::move(list);
+  ASSERT_TRUE(list.empty());
+  ASSERT_EQ(other.size(), 1000);
+  ASSERT_EQ(other.get_allocator().resource(), &other_resource);
+}
+
+// a copy that throws halfway frees the nodes it built
+struct Fragile {
+  static inline int copies_left = -1;
+  std::string value;
+  Fragile(int number) : value(std::to_string(number)) {}
+  Fragile(const Fragile& other) : value(other.value) {
+    if (copies_left-- == 0) throw std::runtime_error("copy");
+  }
+};
+
+TEST(UnrolledList, copy_throwing) {
+  UnrolledList<Fragile> fragile;
+  for (int i = 0; i < 1000; i++) {
+    fragile.emplace_back(i);
+  }
+  Fragile::copies_left = 500;
+  ASSERT_THROW(UnrolledList<Fragile>{fragile}, std::runtime_error);
+  Fragile::copies_left = 1;
+  ASSERT_THROW((UnrolledList<Fragile>{1, 2, 3}), std::runtime_error);
+  Fragile::copies_left = -1;
+  UnrolledList<Fragile> copied(fragile);
+  ASSERT_EQ(copied.back().value, "999");
+}
+
+int main() {
+  testing::InitGoogleTest();
+  return RUN_ALL_TESTS();
+}
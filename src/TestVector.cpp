@@ -4,6 +4,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
+#include <string>
 #include <vector>
 
 #include "vector.h"
@@ -16,7 +20,7 @@ TEST(Vector, basic) {
   //  Emptiness check
 
   ASSERT_EQ(Kala.size(), 0);
-  ASSERT_EQ(Kala.max_size(), 0);
+  ASSERT_EQ(Kala.capacity(), 0);
   ASSERT_TRUE(Kala.empty());
 
   // ASSERT_EQ(Kala.front(), 0);
@@ -54,7 +58,7 @@ TEST(Vector, basic) {
   Kala.push_back(3);
 
   ASSERT_EQ(Kala.size(), 10);
-  ASSERT_EQ(Kala.max_size(), 10);
+  ASSERT_EQ(Kala.capacity(), 16);
 
   //  Shrink_to_fit_check
 
@@ -64,38 +68,53 @@ TEST(Vector, basic) {
   Kala.pop_back();
 
   ASSERT_EQ(Kala.size(), 6);
-  ASSERT_EQ(Kala.max_size(), 10);
-  ASSERT_EQ(Kala.capacity(), 4);
+  ASSERT_EQ(Kala.capacity(), 16);
 
   Kala.push_back(3);
   ASSERT_EQ(Kala.size(), 7);
-  ASSERT_EQ(Kala.max_size(), 10);
-  ASSERT_EQ(Kala.capacity(), 3);
+  ASSERT_EQ(Kala.capacity(), 16);
 
   Kala.shrink_to_fit();
 
   ASSERT_EQ(Kala.size(), 7);
-  ASSERT_EQ(Kala.max_size(), 7);
+  ASSERT_EQ(Kala.capacity(), 7);
 
   //  Reserve check
 
-  Kala.reserve(50);
+  Kala.reserve(57);
 
   ASSERT_EQ(Kala.size(), 7);
-  ASSERT_EQ(Kala.max_size(), 57);
+  ASSERT_EQ(Kala.capacity(), 57);
+
+  Kala.reserve(20);
+
+  ASSERT_EQ(Kala.capacity(), 57);
 
   Kala.push_back(9);
   ASSERT_EQ(Kala.size(), 8);
-  ASSERT_EQ(Kala.max_size(), 57);
-  ASSERT_EQ(Kala.capacity(), 49);
+  ASSERT_EQ(Kala.capacity(), 57);
   ASSERT_EQ(Kala.back(), 9);
+  ASSERT_EQ(Kala.front(), 3);
+
+  //  Growth policy check
+
+  Vector<int, GrowthOneAndHalf> KalaSlow;
+
+  for (int i{0}; i < 10; i++) {
+    KalaSlow.push_back(i);
+  }
+
+  ASSERT_EQ(KalaSlow.size(), 10);
+  ASSERT_EQ(KalaSlow.capacity(), 13);
+  ASSERT_EQ(KalaSlow.front(), 0);
+  ASSERT_EQ(KalaSlow.back(), 9);
 
   //  Parametrized size constructor check
 
   Vector<int> KalaSize(15);
 
   ASSERT_EQ(KalaSize.size(), 0);
-  ASSERT_EQ(KalaSize.max_size(), 15);
+  ASSERT_EQ(KalaSize.capacity(), 15);
 
   KalaSize.push_back(3);
   KalaSize.push_back(6);
@@ -109,19 +128,19 @@ TEST(Vector, basic) {
   KalaSize.swap(KalaEmpty);
 
   ASSERT_EQ(KalaEmpty.size(), 3);
-  ASSERT_EQ(KalaEmpty.max_size(), 15);
+  ASSERT_EQ(KalaEmpty.capacity(), 15);
   ASSERT_EQ(KalaEmpty.front(), 3);
   ASSERT_EQ(KalaEmpty.back(), 7);
 
   ASSERT_EQ(KalaSize.size(), 0);
-  ASSERT_EQ(KalaSize.max_size(), 0);
+  ASSERT_EQ(KalaSize.capacity(), 0);
 
   //  Copy constructor check
 
   Vector<int> KalaCopied(KalaEmpty);
 
   ASSERT_EQ(KalaCopied.size(), 3);
-  ASSERT_EQ(KalaCopied.max_size(), 15);
+  ASSERT_EQ(KalaCopied.capacity(), 15);
   ASSERT_EQ(KalaCopied.front(), 3);
   ASSERT_EQ(KalaCopied.back(), 7);
 
@@ -130,7 +149,7 @@ TEST(Vector, basic) {
   Vector<int> KalaInit = {1, 7, 2, 8, 9};
 
   ASSERT_EQ(KalaInit.size(), 5);
-  ASSERT_EQ(KalaInit.max_size(), 5);
+  ASSERT_EQ(KalaInit.capacity(), 5);
   ASSERT_EQ(KalaInit.front(), 1);
   ASSERT_EQ(KalaInit.back(), 9);
 
@@ -139,12 +158,12 @@ TEST(Vector, basic) {
   Vector<int> KalaMoved(std::move(KalaInit));
 
   ASSERT_EQ(KalaMoved.size(), 5);
-  ASSERT_EQ(KalaMoved.max_size(), 5);
+  ASSERT_EQ(KalaMoved.capacity(), 5);
   ASSERT_EQ(KalaMoved.front(), 1);
   ASSERT_EQ(KalaMoved.back(), 9);
 
   ASSERT_EQ(KalaInit.size(), 0);
-  ASSERT_EQ(KalaInit.max_size(), 0);
+  ASSERT_EQ(KalaInit.capacity(), 0);
   ASSERT_TRUE(KalaInit.empty());
 
   // ASSERT_EQ(KalaInit.front(), 0);
@@ -164,14 +183,14 @@ TEST(Vector, basic) {
 
   iter.Advance(2);
 
-  ASSERT_EQ(iter.GetPosition(), 2);
+  ASSERT_EQ(iter - KalaMoved.begin(), 2);
   ASSERT_EQ(*iter, 8);
 
   KalaMoved.erase(iter);
 
   ASSERT_EQ(*iter, 9);
   ASSERT_EQ(KalaMoved.size(), 3);
-  ASSERT_EQ(KalaMoved.max_size(), 5);
+  ASSERT_EQ(KalaMoved.capacity(), 5);
   ASSERT_EQ(KalaMoved.front(), 7);
   ASSERT_EQ(KalaMoved.back(), 9);
 
@@ -179,11 +198,11 @@ TEST(Vector, basic) {
 
   int ins = 8;
   iter = KalaMoved.insert(iter, ins);
-  ASSERT_EQ(iter.GetPosition(), 2);
+  ASSERT_EQ(iter - KalaMoved.begin(), 2);
   ASSERT_EQ(*iter, 8);
 
   ASSERT_EQ(KalaMoved.size(), 4);
-  ASSERT_EQ(KalaMoved.max_size(), 5);
+  ASSERT_EQ(KalaMoved.capacity(), 5);
   ASSERT_EQ(KalaMoved.front(), 7);
   ASSERT_EQ(KalaMoved.back(), 9);
 
@@ -192,9 +211,12 @@ TEST(Vector, basic) {
   KalaCopied.clear();
 
   ASSERT_EQ(KalaCopied.size(), 0);
-  ASSERT_EQ(KalaCopied.max_size(), 0);
+  ASSERT_EQ(KalaCopied.capacity(), 0);
 
-  KalaCopied.emplace_back(6, 7, 15, 3);
+  KalaCopied.emplace_back(6);
+  KalaCopied.emplace_back(7);
+  KalaCopied.emplace_back(15);
+  ASSERT_EQ(KalaCopied.emplace_back(3), 3);
 
   ASSERT_EQ(KalaCopied.front(), 6);
   ASSERT_EQ(KalaCopied.back(), 3);
@@ -205,7 +227,7 @@ TEST(Vector, basic) {
 
   ASSERT_EQ(*it, 15);
 
-  auto new_it = KalaCopied.emplace(it, 5, 13);
+  auto new_it = KalaCopied.emplace(KalaCopied.emplace(it, 5), 13);
 
   auto check_it = KalaCopied.begin();
 
@@ -226,6 +248,281 @@ TEST(Vector, basic) {
   Vector<int[5]> ooo{};
 }
 
+//  counts live objects so a test can see which slots are constructed
+
+struct Counted {
+  static inline int Constructed{0};
+  static inline int Alive{0};
+
+  Counted() : Value(0) {Constructed++; Alive++;}
+  Counted(int value) : Value(value) {Constructed++; Alive++;}
+  Counted(const Counted &other) : Value(other.Value) {Constructed++; Alive++;}
+  Counted &operator=(const Counted &other) = default;
+  ~Counted() {Alive--;}
+
+  int Value;
+};
+
+TEST(Vector, raw_storage) {
+  {
+    Vector<Counted> Kala;
+    Kala.reserve(1000);
+
+    ASSERT_EQ(Kala.capacity(), 1000);
+    ASSERT_EQ(Counted::Constructed, 0);
+
+    Vector<Counted> KalaSize(500);
+
+    ASSERT_EQ(Counted::Constructed, 0);
+
+    Counted value(1);
+    Kala.push_back(value);
+    Kala.push_back(value);
+    Kala.push_back(value);
+
+    ASSERT_EQ(Counted::Alive, 4);
+
+    Kala.pop_back();
+
+    ASSERT_EQ(Counted::Alive, 3);
+
+    Kala.erase(Kala.begin());
+
+    ASSERT_EQ(Counted::Alive, 2);
+    ASSERT_EQ(Kala.size(), 1);
+
+    Counted front(7);
+    Kala.insert(Kala.begin(), front);
+
+    ASSERT_EQ(Counted::Alive, 4);
+    ASSERT_EQ(Kala.front().Value, 7);
+    ASSERT_EQ(Kala.back().Value, 1);
+
+    Kala.shrink_to_fit();
+
+    ASSERT_EQ(Counted::Alive, 4);
+    ASSERT_EQ(Kala.capacity(), 2);
+
+    Kala.pop_back();
+    Kala.pop_back();
+
+    ASSERT_TRUE(Kala.empty());
+    ASSERT_EQ(Counted::Alive, 2);
+
+    Kala.push_back(value);
+
+    ASSERT_EQ(Kala.front().Value, 1);
+    ASSERT_EQ(Kala.back().Value, 1);
+    ASSERT_THROW(Kala.at(1), std::out_of_range);
+
+    Kala.clear();
+
+    ASSERT_EQ(Counted::Alive, 2);
+  }
+  ASSERT_EQ(Counted::Alive, 0);
+}
+
+//  emplace builds one element from constructor arguments, rvalues are moved
+//  in and growth moves the elements over instead of copying them
+
+struct MoveCounted {
+  static inline int Copies{0};
+
+  MoveCounted(int value) : Value(value) {}
+  MoveCounted(const MoveCounted &other) : Value(other.Value) {Copies++;}
+  MoveCounted(MoveCounted &&other) noexcept : Value(other.Value) {}
+  MoveCounted &operator=(const MoveCounted &other) {
+    Value = other.Value;
+    Copies++;
+    return *this;
+  }
+  MoveCounted &operator=(MoveCounted &&other) noexcept = default;
+
+  int Value;
+};
+
+TEST(Vector, move_and_emplace) {
+  Vector<std::string> Kala;
+
+  ASSERT_EQ(Kala.emplace_back(3, 'x'), "xxx");
+
+  std::string Long(100, 'y');
+  Kala.push_back(std::move(Long));
+
+  ASSERT_TRUE(Long.empty());
+  ASSERT_EQ(Kala.back(), std::string(100, 'y'));
+
+  auto iter = Kala.emplace(Kala.begin(), "front");
+
+  ASSERT_EQ(*iter, "front");
+  ASSERT_EQ(Kala.size(), 3);
+  ASSERT_EQ(Kala[1], "xxx");
+
+  //  the argument is an element of the vector itself and growth is needed
+  Kala.shrink_to_fit();
+  Kala.push_back(Kala[0]);
+
+  ASSERT_EQ(Kala.back(), "front");
+
+  Vector<MoveCounted> Moving;
+  for (int i{0}; i < 100; i++) {
+    Moving.emplace_back(i);
+  }
+  Moving.insert(Moving.begin(), MoveCounted(-1));
+  Moving.erase(Moving.begin());
+
+  ASSERT_EQ(MoveCounted::Copies, 0);
+  ASSERT_EQ(Moving.front().Value, 0);
+  ASSERT_EQ(Moving.back().Value, 99);
+
+  Vector<std::unique_ptr<int>> Unique;
+  for (int i{0}; i < 10; i++) {
+    Unique.push_back(std::make_unique<int>(i));
+  }
+
+  ASSERT_EQ(*Unique[9], 9);
+}
+
+//  opted in as trivially relocatable: growth, insert and erase move the
+//  bytes and never call the move constructor
+
+struct Relocated {
+  static inline int Moves{0};
+
+  Relocated(int value) : Value(std::make_unique<int>(value)) {}
+  Relocated(Relocated &&other) noexcept : Value(std::move(other.Value)) {
+    Moves++;
+  }
+  Relocated &operator=(Relocated &&other) noexcept {
+    Value = std::move(other.Value);
+    Moves++;
+    return *this;
+  }
+
+  std::unique_ptr<int> Value;
+};
+
+template <>
+struct s21::is_trivially_relocatable<Relocated> : std::true_type {};
+
+TEST(Vector, trivially_relocatable) {
+  Vector<Relocated> Kala;
+  Kala.reserve(100);
+  for (int i{0}; i < 100; i++) {
+    Kala.emplace_back(i);
+  }
+
+  //  grows the store; the only move is of the new element into its slot
+  Kala.emplace(Kala.begin(), -1);
+  auto iter = Kala.begin();
+  iter.Advance(50);
+  Kala.erase(iter);
+
+  ASSERT_EQ(Relocated::Moves, 1);
+  ASSERT_EQ(Kala.size(), 100);
+  ASSERT_EQ(*Kala[0].Value, -1);
+  ASSERT_EQ(*Kala[49].Value, 48);
+  ASSERT_EQ(*Kala[50].Value, 50);
+  ASSERT_EQ(*Kala[99].Value, 99);
+
+  Vector<int> Ints;
+  for (int i{0}; i < 1000; i++) {
+    Ints.push_back(i);
+  }
+  auto middle = Ints.begin();
+  middle.Advance(500);
+  Ints.insert(middle, -1);
+  Ints.erase(Ints.begin());
+
+  ASSERT_EQ(Ints[0], 1);
+  ASSERT_EQ(Ints[498], 499);
+  ASSERT_EQ(Ints[499], -1);
+  ASSERT_EQ(Ints[500], 500);
+  ASSERT_EQ(Ints.back(), 999);
+
+  Vector<int> IntsCopied(Ints);
+
+  ASSERT_EQ(IntsCopied[499], -1);
+  ASSERT_EQ(IntsCopied.size(), 1000);
+}
+
+//  a Vector moves in O(1) without throwing and holds no pointer into
+//  itself, so a Vector of them regrows by copying bytes
+
+TEST(Vector, of_vectors) {
+  static_assert(std::is_nothrow_move_constructible_v<Vector<std::string>>);
+  static_assert(std::is_nothrow_move_assignable_v<Vector<std::string>>);
+  static_assert(!std::is_nothrow_move_assignable_v<pmr::Vector<int>>);
+  static_assert(is_trivially_relocatable_v<Vector<std::string>>);
+  static_assert(is_trivially_relocatable_v<pmr::Vector<std::string>>);
+
+  Vector<Vector<std::string>> Nested;
+  Vector<const std::string *> Elements;
+  for (int i{0}; i < 100; i++) {
+    Nested.emplace_back();
+    Nested.back().push_back(std::to_string(i));
+    Elements.push_back(&Nested.back()[0]);
+  }
+  for (int i{0}; i < 100; i++) {
+    ASSERT_EQ(&Nested[i][0], Elements[i]);
+    ASSERT_EQ(Nested[i][0], std::to_string(i));
+  }
+}
+
+TEST(Vector, contiguous_iterator) {
+  static_assert(std::contiguous_iterator<Vector<int>::iterator>);
+  static_assert(std::contiguous_iterator<Vector<int>::const_iterator>);
+  static_assert(std::ranges::contiguous_range<Vector<int>>);
+
+  Vector<int> Kala = {5, 3, 9, 1, 7};
+
+  ASSERT_EQ(Kala.end() - Kala.begin(), 5);
+  ASSERT_EQ(std::to_address(Kala.begin()), Kala.data());
+
+  std::ranges::sort(Kala);
+
+  int Sum{0};
+  int Previous{0};
+  for (int value : Kala) {
+    ASSERT_LE(Previous, value);
+    Previous = value;
+    Sum += value;
+  }
+  ASSERT_EQ(Sum, 25);
+
+  Vector<int>::const_iterator Constant(Kala.begin() + 2);
+
+  ASSERT_EQ(*Constant, 5);
+  ASSERT_EQ(Constant[2], 9);
+  ASSERT_TRUE(Constant < Kala.end());
+
+  Kala.erase(Constant);
+
+  ASSERT_EQ(Kala.size(), 4);
+  ASSERT_EQ(Kala[2], 7);
+}
+
+//  every allocation comes from the buffer: the upstream resource refuses all
+
+TEST(Vector, pmr_monotonic_buffer) {
+  std::byte Buffer[16 * 1024];
+  std::pmr::monotonic_buffer_resource Resource(Buffer, sizeof(Buffer),
+                                               std::pmr::null_memory_resource());
+  s21::pmr::Vector<int> Kala(&Resource);
+  for (int i{0}; i < 1000; i++) {
+    Kala.push_back(i);
+  }
+  ASSERT_EQ(Kala.size(), 1000);
+  ASSERT_EQ(Kala.capacity(), 1024);
+  ASSERT_EQ(Kala[999], 999);
+  ASSERT_EQ(Kala.get_allocator().resource(), &Resource);
+
+  s21::pmr::Vector<int> Moved(std::move(Kala));
+  ASSERT_EQ(Moved.get_allocator().resource(), &Resource);
+  ASSERT_EQ(Moved.back(), 999);
+  ASSERT_TRUE(Kala.empty());
+}
+
 int main() {
   testing::InitGoogleTest();
   return RUN_ALL_TESTS();
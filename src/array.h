@@ -34,7 +34,7 @@ class Array {
 
   void AllocMem(size_type size) {
     if (size != 0) {
-      if (_head == nullptr) delete _head;
+      if (_head == nullptr) delete[] _head;
       _head = new value_type[size];
       _size = size;
     }
@@ -67,8 +67,8 @@ class Array {
     }
   }
 
-  Array(Array&& other) {
-    delete _head;
+  Array(Array&& other) noexcept {
+    delete[] _head;
     _head = other._head;
     _size = other._size;
 
@@ -76,8 +76,8 @@ class Array {
     other._size = 0;
   }
 
-  void operator=(Array&& other) {
-    delete _head;
+  void operator=(Array&& other) noexcept {
+    delete[] _head;
     _head = other._head;
     _size = other._size;
 
@@ -86,7 +86,7 @@ class Array {
   }
 
   ~Array() {
-    if (_head != nullptr) delete _head;
+    if (_head != nullptr) delete[] _head;
   }
 
   class ArrayIterator {
@@ -0,0 +1,35 @@
+#ifndef CONTAINERS_CPP_SRC_BENCHMARK_H_
+#define CONTAINERS_CPP_SRC_BENCHMARK_H_
+
+#include <chrono>
+#include <cstdio>
+
+namespace s21 {
+namespace bench {
+
+//  Runs Function once and returns wall time in milliseconds
+
+template <typename Function>
+double MeasureMs(Function &&function) {
+  auto start = std::chrono::steady_clock::now();
+  function();
+  auto finish = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(finish - start).count();
+}
+
+//  Keeps the optimizer from throwing away a computed value
+
+template <typename Type>
+void DoNotOptimize(Type const &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline void Report(const char *name, size_t count, double ms) {
+  std::printf("%-40s %10zu items %10.2f ms %8.2f ns/item\n", name, count, ms,
+              ms * 1e6 / count);
+}
+
+}  // namespace bench
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_SRC_BENCHMARK_H_
@@ -0,0 +1,324 @@
+#ifndef CONTAINERS_CPP_SRC_CONCURRENTQUEUE_H_
+#define CONTAINERS_CPP_SRC_CONCURRENTQUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+namespace s21 {
+
+//  Size of the block the cache coherency protocol moves between cores;
+//  indices written by different threads are kept on different lines
+
+inline constexpr size_t CacheLineSize{64};
+
+//  Busy-waits a little and then gives the core away, so waiting threads
+//  do not starve the one they are waiting for
+
+class SpinBackoff {
+ public:
+  void Pause() {
+    if (Spins < MaxSpins) {
+      Spins += 1;
+#if defined(__x86_64__) || defined(__i386__)
+      __builtin_ia32_pause();
+#endif
+    } else {
+      std::this_thread::yield();
+    }
+  }
+
+  void Reset() {Spins = 0;}
+
+ private:
+  static constexpr unsigned MaxSpins{64};
+  unsigned Spins{0};
+};
+
+//  Bounded lock-free queue for exactly one producer thread (push side) and
+//  one consumer thread (front/pop side). Head and Tail only grow and are
+//  masked into the store; each side keeps a cached copy of the other side's
+//  index so it touches the shared cache line only when the cache runs out
+
+template<typename Type, size_t Capacity>
+class SpscQueue {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                "SpscQueue capacity must be a power of two");
+
+ public:
+  typedef size_t size_type;
+  typedef Type value_type;
+  typedef Type &reference;
+  typedef const Type &const_reference;
+
+  SpscQueue() {}
+
+  SpscQueue(const SpscQueue &other) = delete;
+
+  SpscQueue &operator=(const SpscQueue &other) = delete;
+
+  //  producer side
+
+  bool try_push(const_reference value);
+
+  size_type try_push_n(const value_type *values, size_type count);
+
+  void push(const_reference value) {
+    SpinBackoff backoff;
+    while (!try_push(value)) {
+      backoff.Pause();
+    }
+  }
+
+  //  consumer side
+
+  bool try_pop(reference value);
+
+  size_type try_pop_n(value_type *values, size_type count);
+
+  reference front() {
+    size_type head{Head.load(std::memory_order_relaxed)};
+    if (!Readable(head, 1)) {
+      throw std::out_of_range("No such element");
+    }
+    return Store[head & Mask];
+  }
+
+  void pop() {
+    size_type head{Head.load(std::memory_order_relaxed)};
+    if (!Readable(head, 1)) {
+      throw std::out_of_range("No such element");
+    }
+    Store[head & Mask] = value_type{};
+    Head.store(head + 1, std::memory_order_release);
+  }
+
+  //  either side, exact only while the other side is idle
+
+  bool empty() const {return size() == 0;}
+
+  size_type size() const {
+    return Tail.load(std::memory_order_acquire) -
+           Head.load(std::memory_order_acquire);
+  }
+
+  static constexpr size_type capacity() {return Capacity;}
+
+ private:
+  static constexpr size_type Mask{Capacity - 1};
+
+  alignas(CacheLineSize) std::atomic<size_type> Head{0};
+  size_type CachedTail{0};
+
+  alignas(CacheLineSize) std::atomic<size_type> Tail{0};
+  size_type CachedHead{0};
+
+  alignas(CacheLineSize) std::unique_ptr<Type[]> Store{new Type[Capacity]{}};
+
+  //  producer: can count more elements be written after tail
+
+  bool Writable(size_type tail, size_type count) {
+    if (tail - CachedHead + count > Capacity) {
+      CachedHead = Head.load(std::memory_order_acquire);
+    }
+    return tail - CachedHead + count <= Capacity;
+  }
+
+  //  consumer: are count elements published after head
+
+  bool Readable(size_type head, size_type count) {
+    if (CachedTail - head < count) {
+      CachedTail = Tail.load(std::memory_order_acquire);
+    }
+    return CachedTail - head >= count;
+  }
+};
+
+template<typename Type, size_t Capacity>
+bool SpscQueue<Type, Capacity>::try_push(const_reference value) {
+  size_type tail{Tail.load(std::memory_order_relaxed)};
+  bool pushed{Writable(tail, 1)};
+  if (pushed) {
+    Store[tail & Mask] = value;
+    Tail.store(tail + 1, std::memory_order_release);
+  }
+  return pushed;
+}
+
+//  pushes as many of count values as fit and publishes them with one store
+
+template<typename Type, size_t Capacity>
+typename SpscQueue<Type, Capacity>::size_type
+SpscQueue<Type, Capacity>::try_push_n(const value_type *values,
+                                      size_type count) {
+  size_type tail{Tail.load(std::memory_order_relaxed)};
+  if (!Writable(tail, count)) {
+    count = Capacity - (tail - CachedHead);
+  }
+  for (size_type i{0}; i < count; i++) {
+    Store[(tail + i) & Mask] = values[i];
+  }
+  if (count != 0) {
+    Tail.store(tail + count, std::memory_order_release);
+  }
+  return count;
+}
+
+template<typename Type, size_t Capacity>
+bool SpscQueue<Type, Capacity>::try_pop(reference value) {
+  size_type head{Head.load(std::memory_order_relaxed)};
+  bool popped{Readable(head, 1)};
+  if (popped) {
+    value = std::move(Store[head & Mask]);
+    Head.store(head + 1, std::memory_order_release);
+  }
+  return popped;
+}
+
+//  pops up to count values and releases their slots with one store
+
+template<typename Type, size_t Capacity>
+typename SpscQueue<Type, Capacity>::size_type
+SpscQueue<Type, Capacity>::try_pop_n(value_type *values, size_type count) {
+  size_type head{Head.load(std::memory_order_relaxed)};
+  if (!Readable(head, count)) {
+    count = CachedTail - head;
+  }
+  for (size_type i{0}; i < count; i++) {
+    values[i] = std::move(Store[(head + i) & Mask]);
+  }
+  if (count != 0) {
+    Head.store(head + count, std::memory_order_release);
+  }
+  return count;
+}
+
+//  Bounded lock-free queue for any number of producers and consumers
+//  (D. Vyukov's scheme). Every slot carries a sequence number telling whose
+//  turn it is: a producer may fill slot pos & Mask when its sequence is pos,
+//  a consumer may empty it when the sequence is pos + 1. Threads claim
+//  positions with a CAS on Tail/Head and then touch only their own slot.
+//  front() is not offered: a peeked element could be popped and overwritten
+//  by another consumer while the caller still reads it
+
+template<typename Type, size_t Capacity>
+class MpmcQueue {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                "MpmcQueue capacity must be a power of two");
+
+ public:
+  typedef size_t size_type;
+  typedef Type value_type;
+  typedef Type &reference;
+  typedef const Type &const_reference;
+
+  MpmcQueue() {
+    for (size_type i{0}; i < Capacity; i++) {
+      Store[i].Sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  MpmcQueue(const MpmcQueue &other) = delete;
+
+  MpmcQueue &operator=(const MpmcQueue &other) = delete;
+
+  //  non-blocking: false when the queue is full / empty
+
+  bool try_push(const_reference value);
+
+  bool try_pop(reference value);
+
+  //  blocking: wait until there is room / an element
+
+  void push(const_reference value) {
+    SpinBackoff backoff;
+    while (!try_push(value)) {
+      backoff.Pause();
+    }
+  }
+
+  void pop(reference value) {
+    SpinBackoff backoff;
+    while (!try_pop(value)) {
+      backoff.Pause();
+    }
+  }
+
+  //  snapshots, exact only while no other thread works with the queue
+
+  bool empty() const {return size() == 0;}
+
+  size_type size() const {
+    size_type head{Head.load(std::memory_order_acquire)};
+    size_type tail{Tail.load(std::memory_order_acquire)};
+    return tail > head ? tail - head : 0;
+  }
+
+  static constexpr size_type capacity() {return Capacity;}
+
+ private:
+  static constexpr size_type Mask{Capacity - 1};
+
+  struct Slot {
+    std::atomic<size_type> Sequence;
+    Type Value{};
+  };
+
+  alignas(CacheLineSize) std::atomic<size_type> Tail{0};
+  alignas(CacheLineSize) std::atomic<size_type> Head{0};
+  alignas(CacheLineSize) std::unique_ptr<Slot[]> Store{new Slot[Capacity]};
+};
+
+template<typename Type, size_t Capacity>
+bool MpmcQueue<Type, Capacity>::try_push(const_reference value) {
+  size_type position{Tail.load(std::memory_order_relaxed)};
+  Slot *slot;
+  for (;;) {
+    slot = &Store[position & Mask];
+    size_type sequence{slot->Sequence.load(std::memory_order_acquire)};
+    auto turn = static_cast<std::ptrdiff_t>(sequence - position);
+    if (turn == 0) {
+      if (Tail.compare_exchange_weak(position, position + 1,
+                                     std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (turn < 0) {
+      return false;
+    } else {
+      position = Tail.load(std::memory_order_relaxed);
+    }
+  }
+  slot->Value = value;
+  slot->Sequence.store(position + 1, std::memory_order_release);
+  return true;
+}
+
+template<typename Type, size_t Capacity>
+bool MpmcQueue<Type, Capacity>::try_pop(reference value) {
+  size_type position{Head.load(std::memory_order_relaxed)};
+  Slot *slot;
+  for (;;) {
+    slot = &Store[position & Mask];
+    size_type sequence{slot->Sequence.load(std::memory_order_acquire)};
+    auto turn = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+    if (turn == 0) {
+      if (Head.compare_exchange_weak(position, position + 1,
+                                     std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (turn < 0) {
+      return false;
+    } else {
+      position = Head.load(std::memory_order_relaxed);
+    }
+  }
+  value = std::move(slot->Value);
+  slot->Sequence.store(position + Capacity, std::memory_order_release);
+  return true;
+}
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_SRC_CONCURRENTQUEUE_H_
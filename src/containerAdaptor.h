@@ -6,186 +6,200 @@
 #define CONTAINERS_CPP_SRC_CONTAINERADAPTOR_H_
 
 #include <memory>
+#include <memory_resource>
 #include <initializer_list>
 #include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "relocate.h"
+#include "ringBuffer.h"
+#include "vector.h"
 
 namespace s21 {
-template<typename Type>
+
+//  Adaptors keep their elements in an underlying Container, as std::stack
+//  and std::queue do: the adaptor only decides which end is accessible.
+//  Stack pushes and pops at the back of the container and by default uses
+//  Vector (one contiguous block, doubled when full). Queue pushes at the
+//  back and pops at the front and by default uses RingBuffer. s21::List
+//  fits both when every element has to stay at its address, at the cost
+//  of one allocation per push.
+//  The container brings its allocator: s21::pmr::Stack and s21::pmr::Queue
+//  below place the store in a std::pmr::memory_resource
+
+template<typename Container>
 class ContainerAdaptor {
  public:
-  typedef size_t size_type;
-  typedef Type value_type;
-  typedef Type &reference;
-  typedef Type &const_reference;
+  typedef Container container_type;
+  typedef typename Container::size_type size_type;
+  typedef typename Container::value_type value_type;
+  typedef typename Container::reference reference;
+  typedef typename Container::const_reference const_reference;
+  typedef typename Container::allocator_type allocator_type;
 
   ContainerAdaptor() {
   }
 
-  ContainerAdaptor(std::initializer_list<value_type> const &items) {
-    Position = items.size() - 1;
-    Store.reset(new Type[items.size()]{});
-    auto iter{items.begin()};
-    for (int i{0}; iter != items.end(); i++, iter++) {
-      GetStore(i) = *iter;
+  explicit ContainerAdaptor(const allocator_type &alloc) : Store(alloc) {}
+
+  explicit ContainerAdaptor(const Container &store) : Store(store) {}
+
+  explicit ContainerAdaptor(Container &&store) : Store(std::move(store)) {}
+
+  ContainerAdaptor(std::initializer_list<value_type> const &items,
+                   const allocator_type &alloc = allocator_type())
+      : Store(alloc) {
+    for (auto iter{items.begin()}; iter != items.end(); iter++) {
+      push(*iter);
     }
   }
 
-  ContainerAdaptor(const ContainerAdaptor &old) {
-    Position = old.Position;
-    ReallocateStoreAfterPush(old);
-  }
+  ContainerAdaptor(const ContainerAdaptor &old) : Store(old.Store) {}
 
-  ContainerAdaptor(ContainerAdaptor &&old) {
-    Position = old.Position;
-    Store.swap(old.Store);
-    old.Position = -1;
-  }
+  ContainerAdaptor(ContainerAdaptor &&old) noexcept(
+      std::is_nothrow_move_constructible_v<Container>)
+      : Store(std::move(old.Store)) {}
 
-  ~ContainerAdaptor() {
-  }
+  void push(const value_type &value) {Store.push_back(value);}
 
-  void push(Type &value);
+  void push(value_type &&value) {Store.push_back(std::move(value));}
 
-  bool empty();
+  //  builds one element from args at the back of the container. Vector,
+  //  SmallVector, Deque and RingBuffer build a single element in
+  //  emplace_back; List pushes every argument, so over a List pass one
 
-  void swap(ContainerAdaptor &other);
+  template<class... Args>
+  reference emplace(Args&&... args) {
+    Store.emplace_back(std::forward<Args>(args)...);
+    return Store.back();
+  }
 
-  void operator=(ContainerAdaptor &&old);
+  bool empty() {return Store.empty();}
 
-  size_type size() {return Position + 1;}
+  size_type size() {return Store.size();}
 
-  //  auxiliary methods
+  void swap(ContainerAdaptor &other) {Store.swap(other.Store);}
 
-  Type& GetStore(int pos) {return Store[pos];};
+  void operator=(ContainerAdaptor &&old) noexcept(
+      std::is_nothrow_move_assignable_v<Container>) {
+    Store = std::move(old.Store);
+  }
 
-  int GetPosition() {return Position;}
+  void clear() {Store.clear();}
 
-  void DecreasePosition() {Position -= 1;}
+  allocator_type get_allocator() {return Store.get_allocator();}
 
- protected:
+  //  auxiliary methods
 
-  void ReallocateStoreAfterPush(const ContainerAdaptor &old);
+  Container &GetContainer() {return Store;}
 
-  void ReallocateStoreAfterPop(const ContainerAdaptor &old);
+ protected:
+  Container Store;
 
- private:
-  int Position{-1};
-  std::unique_ptr<Type[]> Store{new Type[1]{}};
+  void CheckNotEmpty() {
+    if (Store.empty()) {
+      throw std::out_of_range("No such element");
+    }
+  }
 };
 
-template<typename Type>
-class Stack : public ContainerAdaptor<Type> {
-  using ContainerAdaptor<Type>::ContainerAdaptor;
+template<typename Type, typename Container = Vector<Type>>
+class Stack : public ContainerAdaptor<Container> {
+  using ContainerAdaptor<Container>::ContainerAdaptor;
+  using ContainerAdaptor<Container>::Store;
  public:
   void pop() {
-    if (ContainerAdaptor<Type>::empty()) {
-      throw std::out_of_range("No such element");
-    }
-    top() = 0;
-    ContainerAdaptor<Type>::DecreasePosition();
+    ContainerAdaptor<Container>::CheckNotEmpty();
+    Store.pop_back();
   }
 
-  ContainerAdaptor<Type>::reference top() {
-    if (ContainerAdaptor<Type>::empty()) {
-      throw std::out_of_range("No such element");
-    }
-    return ContainerAdaptor<Type>::GetStore(ContainerAdaptor<Type>::GetPosition());
+  ContainerAdaptor<Container>::reference top() {
+    ContainerAdaptor<Container>::CheckNotEmpty();
+    return Store.back();
+  }
+
+  //  capacity control, for containers that have a capacity
+
+  ContainerAdaptor<Container>::size_type capacity()
+    requires requires(Container store) { store.capacity(); } {
+    return Store.capacity();
+  }
+
+  void reserve(ContainerAdaptor<Container>::size_type NewCapacity)
+    requires requires(Container store) { store.reserve(1); } {
+    Store.reserve(NewCapacity);
+  }
+
+  void shrink_to_fit()
+    requires requires(Container store) { store.shrink_to_fit(); } {
+    Store.shrink_to_fit();
   }
 
   void emplace_front() {}
   template <class T, class... Args>
   void emplace_front(T data, Args... args) {
-    ContainerAdaptor<Type>::push(data);
+    ContainerAdaptor<Container>::push(data);
     emplace_front(args...);
   }
  private:
 };
 
-template<typename Type>
-class Queue : public ContainerAdaptor<Type> {
-  using ContainerAdaptor<Type>::ContainerAdaptor;
+template<typename Type, typename Container = RingBuffer<Type>>
+class Queue : public ContainerAdaptor<Container> {
+  using ContainerAdaptor<Container>::ContainerAdaptor;
+  using ContainerAdaptor<Container>::Store;
  public:
-  ContainerAdaptor<Type>::reference front() {
-    if (ContainerAdaptor<Type>::empty()) {
-      throw std::out_of_range("No such element");
-    }
-    return ContainerAdaptor<Type>::GetStore(0);
+  void pop() {
+    ContainerAdaptor<Container>::CheckNotEmpty();
+    Store.pop_front();
   }
 
-  ContainerAdaptor<Type>::reference back() {
-    if (ContainerAdaptor<Type>::empty()) {
-      throw std::out_of_range("No such element");
-    }
-    return ContainerAdaptor<Type>::GetStore(ContainerAdaptor<Type>::GetPosition());
+  ContainerAdaptor<Container>::reference front() {
+    ContainerAdaptor<Container>::CheckNotEmpty();
+    return Store.front();
+  }
+
+  ContainerAdaptor<Container>::reference back() {
+    ContainerAdaptor<Container>::CheckNotEmpty();
+    return Store.back();
+  }
+
+  ContainerAdaptor<Container>::size_type capacity()
+    requires requires(Container store) { store.capacity(); } {
+    return Store.capacity();
   }
 
   void emplace_back() {}
   template <class T, class... Args>
   void emplace_back(T data, Args... args) {
-    ContainerAdaptor<Type>::push(data);
+    ContainerAdaptor<Container>::push(data);
     emplace_back(args...);
   }
-
-  void pop() {
-    if (ContainerAdaptor<Type>::empty()) {
-      throw std::out_of_range("No such element");
-    }
-    front() = 0;
-    ContainerAdaptor<Type>::DecreasePosition();
-    ContainerAdaptor<Type>::ReallocateStoreAfterPop(*this);
-  }
  private:
 };
 
-template<typename Type>
-void ContainerAdaptor<Type>::operator=(ContainerAdaptor &&old) {
-  Position = old.Position;
-  ReallocateStoreAfterPush(old);
-}
-
-template<typename Type>
-void ContainerAdaptor<Type>::swap(ContainerAdaptor &other){
-  std::swap(Position, other.Position);
-  Store.swap(other.Store);
-}
+//  an adaptor is its container and relocates the way the container does
 
+template<typename Type, typename Container>
+struct is_trivially_relocatable<Stack<Type, Container>>
+    : is_trivially_relocatable<Container> {};
 
-template<typename Type>
-void ContainerAdaptor<Type>::push(Type &value) {
-    Position += 1;
-    ReallocateStoreAfterPush(*this);
-    Store[Position] = value;
-  }
+template<typename Type, typename Container>
+struct is_trivially_relocatable<Queue<Type, Container>>
+    : is_trivially_relocatable<Container> {};
 
+namespace pmr {
 
 template<typename Type>
-bool ContainerAdaptor<Type>::empty() {
-    bool result = false;
-    if (Position < 0) {
-      result = true;
-    }
-    return result;
-  }
-
+using Stack = s21::Stack<Type, s21::pmr::Vector<Type>>;
 
 template<typename Type>
-void ContainerAdaptor<Type>::ReallocateStoreAfterPush(const ContainerAdaptor &old) {
-    std::unique_ptr<Type[]> store{new Type[Position+1]{}};
-    for (int i{0}; i <= Position; i++) {
-      store[i] = old.Store[i];
-    }
-    Store = std::move(store);
-  }
+using Queue = s21::Queue<Type, s21::pmr::RingBuffer<Type>>;
 
+}  // namespace pmr
 
-template<typename Type>
-void ContainerAdaptor<Type>::ReallocateStoreAfterPop(const ContainerAdaptor &old) {
-    std::unique_ptr<Type[]> store{new Type[Position+1]{}};
-    for (int i{Position}, j{Position + 1}; i >= 0; i--, j--) {
-      store[i] = old.Store[j];
-    }
-    Store = std::move(store);
-  }
 }
 
 
@@ -5,9 +5,16 @@
 #ifndef CONTAINERS_CPP_SRC_S21_CONTAINERS_H_
 #define CONTAINERS_CPP_SRC_S21_CONTAINERS_H_
 
+#include "concurrentQueue.h"
 #include "containerAdaptor.h"
+#include "deque.h"
+#include "intrusiveList.h"
 #include "list.h"
 #include "map.h"
+#include "ringBuffer.h"
+#include "smallVector.h"
+#include "unorderedMap.h"
+#include "unrolledList.h"
 #include "vector.h"
 
 #endif  // CONTAINERS_CPP_SRC_S21_CONTAINERS_H_
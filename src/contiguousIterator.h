@@ -0,0 +1,109 @@
+#ifndef CONTAINERS_CPP_SRC_CONTIGUOUSITERATOR_H_
+#define CONTAINERS_CPP_SRC_CONTIGUOUSITERATOR_H_
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace s21 {
+
+//  Iterator over elements stored one after another, it is nothing but a
+//  pointer: copying it is free, dereference is a single load and it models
+//  std::contiguous_iterator, so range-for and std algorithms over a Vector
+//  compile to the same loop as over a plain array.
+//  ContiguousIterator<const Type> is the const iterator, a mutable iterator
+//  converts to it
+
+template <typename Type>
+class ContiguousIterator {
+ public:
+  typedef std::contiguous_iterator_tag iterator_concept;
+  typedef std::random_access_iterator_tag iterator_category;
+  typedef std::remove_cv_t<Type> value_type;
+  typedef Type element_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Type *pointer;
+  typedef Type &reference;
+
+  ContiguousIterator() {}
+
+  explicit ContiguousIterator(Type *InitPointer) : Pointer(InitPointer) {}
+
+  template <typename Other>
+    requires std::is_convertible_v<Other *, Type *>
+  ContiguousIterator(const ContiguousIterator<Other> &other)
+      : Pointer(other.GetPointer()) {}
+
+  reference operator*() const {return *Pointer;}
+
+  pointer operator->() const {return Pointer;}
+
+  reference operator[](difference_type n) const {return Pointer[n];}
+
+  ContiguousIterator &operator++() {
+    ++Pointer;
+    return *this;
+  }
+
+  ContiguousIterator operator++(int) {
+    ContiguousIterator old(*this);
+    ++Pointer;
+    return old;
+  }
+
+  ContiguousIterator &operator--() {
+    --Pointer;
+    return *this;
+  }
+
+  ContiguousIterator operator--(int) {
+    ContiguousIterator old(*this);
+    --Pointer;
+    return old;
+  }
+
+  ContiguousIterator &operator+=(difference_type n) {
+    Pointer += n;
+    return *this;
+  }
+
+  ContiguousIterator &operator-=(difference_type n) {
+    Pointer -= n;
+    return *this;
+  }
+
+  ContiguousIterator operator+(difference_type n) const {
+    return ContiguousIterator(Pointer + n);
+  }
+
+  friend ContiguousIterator operator+(difference_type n,
+                                      const ContiguousIterator &iter) {
+    return iter + n;
+  }
+
+  ContiguousIterator operator-(difference_type n) const {
+    return ContiguousIterator(Pointer - n);
+  }
+
+  difference_type operator-(const ContiguousIterator &other) const {
+    return Pointer - other.Pointer;
+  }
+
+  bool operator==(const ContiguousIterator &other) const = default;
+
+  auto operator<=>(const ContiguousIterator &other) const = default;
+
+  void Advance(size_t repeat) {Pointer += repeat;}
+
+  void Decrease(size_t repeat) {Pointer -= repeat;}
+
+  pointer GetPointer() const {return Pointer;}
+
+ private:
+  Type *Pointer{nullptr};
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_SRC_CONTIGUOUSITERATOR_H_
@@ -0,0 +1,522 @@
+#ifndef CONTAINERS_CPP_SRC_DEQUE_H_
+#define CONTAINERS_CPP_SRC_DEQUE_H_
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "relocate.h"
+
+namespace s21 {
+
+//  Deque keeps its elements in fixed-size blocks of BlockSize slots (about
+//  4 KB each). The blocks are listed in order in the block map, an array of
+//  block pointers with free room at both of its ends:
+//
+//    Map:   [ - | - | b0 | b1 | b2 | - ]
+//                      ^Begin     ^Finish
+//
+//  push and pop at either end only touch the first or the last block, a
+//  block is allocated when an end runs out of room and freed as soon as it
+//  is empty. The elements never move, so references to them stay valid
+//  through push and pop at the ends; only the small map is reallocated,
+//  and its growth is doubled like Vector's store.
+//  Begin points at the front element, Finish one past the back one, and
+//  the block Finish points into is always allocated.
+
+template <typename Type, size_t BlockSize>
+class DequeIterator {
+ public:
+  typedef std::random_access_iterator_tag iterator_category;
+  typedef std::remove_cv_t<Type> value_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Type *pointer;
+  typedef Type &reference;
+  typedef value_type *const *map_pointer;
+
+  DequeIterator() {}
+
+  DequeIterator(Type *InitCurrent, map_pointer InitNode)
+      : Current(InitCurrent), Node(InitNode) {}
+
+  template <typename Other>
+    requires std::is_convertible_v<Other *, Type *>
+  DequeIterator(const DequeIterator<Other, BlockSize> &other)
+      : Current(other.GetPointer()), Node(other.GetNode()) {}
+
+  reference operator*() const {return *Current;}
+
+  pointer operator->() const {return Current;}
+
+  reference operator[](difference_type n) const {return *(*this + n);}
+
+  DequeIterator &operator++() {
+    ++Current;
+    if (Current == *Node + BlockSize) {
+      ++Node;
+      Current = *Node;
+    }
+    return *this;
+  }
+
+  DequeIterator operator++(int) {
+    DequeIterator old(*this);
+    ++*this;
+    return old;
+  }
+
+  DequeIterator &operator--() {
+    if (Current == *Node) {
+      --Node;
+      Current = *Node + BlockSize;
+    }
+    --Current;
+    return *this;
+  }
+
+  DequeIterator operator--(int) {
+    DequeIterator old(*this);
+    --*this;
+    return old;
+  }
+
+  DequeIterator &operator+=(difference_type n) {
+    if (n == 0) {
+      return *this;
+    }
+    difference_type Offset{n + (Current - *Node)};
+    if (Offset >= 0 && Offset < static_cast<difference_type>(BlockSize)) {
+      Current += n;
+    } else {
+      difference_type NodeOffset{
+          Offset > 0 ? Offset / static_cast<difference_type>(BlockSize)
+                     : -((-Offset - 1) / static_cast<difference_type>(
+                             BlockSize)) - 1};
+      Node += NodeOffset;
+      Current = *Node + (Offset - NodeOffset *
+                                      static_cast<difference_type>(BlockSize));
+    }
+    return *this;
+  }
+
+  DequeIterator &operator-=(difference_type n) {return *this += -n;}
+
+  DequeIterator operator+(difference_type n) const {
+    DequeIterator moved(*this);
+    return moved += n;
+  }
+
+  friend DequeIterator operator+(difference_type n,
+                                 const DequeIterator &iter) {
+    return iter + n;
+  }
+
+  DequeIterator operator-(difference_type n) const {
+    DequeIterator moved(*this);
+    return moved -= n;
+  }
+
+  difference_type operator-(const DequeIterator &other) const {
+    if (Node == other.Node) {
+      return Current - other.Current;
+    }
+    return static_cast<difference_type>(BlockSize) * (Node - other.Node) +
+           (Current - *Node) - (other.Current - *other.Node);
+  }
+
+  bool operator==(const DequeIterator &other) const {
+    return Current == other.Current;
+  }
+
+  std::strong_ordering operator<=>(const DequeIterator &other) const {
+    if (Node != other.Node) {
+      return Node <=> other.Node;
+    }
+    return Current <=> other.Current;
+  }
+
+  pointer GetPointer() const {return Current;}
+
+  map_pointer GetNode() const {return Node;}
+
+ private:
+  Type *Current{nullptr};
+  map_pointer Node{nullptr};
+};
+
+template <typename Type, typename Allocator = std::allocator<Type>>
+class Deque {
+ public:
+  static constexpr size_t BlockSize{
+      std::bit_floor(sizeof(Type) < 256 ? 4096 / sizeof(Type) : size_t{16})};
+
+  typedef size_t size_type;
+  typedef Type value_type;
+  typedef Type &reference;
+  typedef const Type &const_reference;
+  typedef Allocator allocator_type;
+  typedef DequeIterator<Type, BlockSize> iterator;
+  typedef DequeIterator<const Type, BlockSize> const_iterator;
+
+  Deque() {}
+
+  explicit Deque(const Allocator &alloc) : Alloc(alloc), MapAlloc(alloc) {}
+
+  Deque(std::initializer_list<value_type> const &items,
+        const Allocator &alloc = Allocator())
+      : Alloc(alloc), MapAlloc(alloc) {
+    try {
+      for (auto iter{items.begin()}; iter != items.end(); iter++) {
+        push_back(*iter);
+      }
+    } catch (...) {
+      clear();
+      ReleaseMap();
+      throw;
+    }
+  }
+
+  //  a copy that throws frees what it has built, no destructor runs
+
+  Deque(const Deque &other)
+      : Alloc(alloc_traits::select_on_container_copy_construction(other.Alloc)),
+        MapAlloc(Alloc) {
+    try {
+      for (auto iter{other.begin()}; iter != other.end(); ++iter) {
+        push_back(*iter);
+      }
+    } catch (...) {
+      clear();
+      ReleaseMap();
+      throw;
+    }
+  }
+
+  Deque(Deque &&other) noexcept
+      : Alloc(other.Alloc), MapAlloc(other.MapAlloc) {
+    SwapStore(other);
+  }
+
+  ~Deque() {
+    clear();
+    ReleaseMap();
+  }
+
+  void operator=(Deque &&other) noexcept(move_assignment_steals_v<Allocator>);
+
+  //  element access, front, back and the pops expect a non-empty deque
+
+  reference operator[](size_type pos) {
+    size_type Offset{pos + (Begin.GetPointer() - *Begin.GetNode())};
+    return Begin.GetNode()[Offset / BlockSize][Offset % BlockSize];
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size()) {
+      throw std::out_of_range("No such element");
+    }
+    return (*this)[pos];
+  }
+
+  reference front() {return *Begin;}
+
+  reference back() {
+    iterator Last{Finish};
+    return *--Last;
+  }
+
+  //  iterators
+
+  iterator begin() {return Begin;}
+
+  iterator end() {return Finish;}
+
+  const_iterator begin() const {return Begin;}
+
+  const_iterator end() const {return Finish;}
+
+  //  capacity
+
+  bool empty() const {return Begin == Finish;}
+
+  size_type size() const {return Finish - Begin;}
+
+  //  modifiers
+
+  void push_back(const Type &value) {emplace_back(value);}
+
+  void push_back(Type &&value) {emplace_back(std::move(value));}
+
+  void push_front(const Type &value) {emplace_front(value);}
+
+  void push_front(Type &&value) {emplace_front(std::move(value));}
+
+  template <class... Args>
+  reference emplace_back(Args&&... args) {
+    Type *Slot{Finish.GetPointer()};
+    if (Map == nullptr || Slot + 1 == *Finish.GetNode() + BlockSize) {
+      return EmplaceBackBlock(std::forward<Args>(args)...);
+    }
+    alloc_traits::construct(Alloc, Slot, std::forward<Args>(args)...);
+    Finish = iterator(Slot + 1, Finish.GetNode());
+    return *Slot;
+  }
+
+  template <class... Args>
+  reference emplace_front(Args&&... args) {
+    if (Map == nullptr || Begin.GetPointer() == *Begin.GetNode()) {
+      return EmplaceFrontBlock(std::forward<Args>(args)...);
+    }
+    Type *Slot{Begin.GetPointer() - 1};
+    alloc_traits::construct(Alloc, Slot, std::forward<Args>(args)...);
+    Begin = iterator(Slot, Begin.GetNode());
+    return *Slot;
+  }
+
+  void pop_back() {
+    if (Finish.GetPointer() == *Finish.GetNode()) {
+      DeallocateBlock(*Finish.GetNode());
+    }
+    --Finish;
+    alloc_traits::destroy(Alloc, Finish.GetPointer());
+  }
+
+  void pop_front() {
+    alloc_traits::destroy(Alloc, Begin.GetPointer());
+    if (Begin.GetPointer() + 1 == *Begin.GetNode() + BlockSize) {
+      DeallocateBlock(*Begin.GetNode());
+    }
+    ++Begin;
+  }
+
+  void clear();
+
+  void swap(Deque &other);
+
+  allocator_type get_allocator() {return Alloc;}
+
+ private:
+  typedef std::allocator_traits<Allocator> alloc_traits;
+  typedef typename alloc_traits::template rebind_alloc<Type *> map_allocator;
+  typedef std::allocator_traits<map_allocator> map_traits;
+
+  static constexpr size_type MinMapSize{8};
+
+  Allocator Alloc;
+  map_allocator MapAlloc;
+  Type **Map{nullptr};
+  size_type MapSize{0};
+  iterator Begin;
+  iterator Finish;
+
+  Type *AllocateBlock() {return alloc_traits::allocate(Alloc, BlockSize);}
+
+  void DeallocateBlock(Type *block) {
+    alloc_traits::deallocate(Alloc, block, BlockSize);
+  }
+
+  Type **GetNode(const iterator &iter) const {
+    return const_cast<Type **>(iter.GetNode());
+  }
+
+  void InitializeMap();
+
+  void ReserveMap(size_type NodesToAdd, bool AtFront);
+
+  void ReleaseMap();
+
+  template <class... Args>
+  reference EmplaceBackBlock(Args&&... args);
+
+  template <class... Args>
+  reference EmplaceFrontBlock(Args&&... args);
+
+  void SwapStore(Deque &other) {
+    std::swap(Map, other.Map);
+    std::swap(MapSize, other.MapSize);
+    std::swap(Begin, other.Begin);
+    std::swap(Finish, other.Finish);
+  }
+};
+
+//  an empty map holds one block, both ends start in its middle so that the
+//  first pushes on either side do not allocate
+
+template <typename Type, typename Allocator>
+void Deque<Type, Allocator>::InitializeMap() {
+  Type **map{map_traits::allocate(MapAlloc, MinMapSize)};
+  Type **Node{map + MinMapSize / 2};
+  try {
+    *Node = AllocateBlock();
+  } catch (...) {
+    map_traits::deallocate(MapAlloc, map, MinMapSize);
+    throw;
+  }
+  Map = map;
+  MapSize = MinMapSize;
+  Begin = iterator(*Node + BlockSize / 2, Node);
+  Finish = Begin;
+}
+
+//  makes room in the map for NodesToAdd more blocks at the front or at the
+//  back: the used part is centered again if the map is at most half full,
+//  otherwise the map grows. Only block pointers move, never elements
+
+template <typename Type, typename Allocator>
+void Deque<Type, Allocator>::ReserveMap(size_type NodesToAdd, bool AtFront) {
+  Type **First{GetNode(Begin)};
+  Type **Last{GetNode(Finish)};
+  if (AtFront ? static_cast<size_type>(First - Map) >= NodesToAdd
+              : static_cast<size_type>(Map + MapSize - Last) > NodesToAdd) {
+    return;
+  }
+  size_type OldNodes = Last - First + 1;
+  size_type NewNodes{OldNodes + NodesToAdd};
+  Type **NewFirst{nullptr};
+  if (MapSize > 2 * NewNodes) {
+    NewFirst = Map + (MapSize - NewNodes) / 2 + (AtFront ? NodesToAdd : 0);
+    std::memmove(static_cast<void *>(NewFirst), static_cast<void *>(First),
+                 OldNodes * sizeof(Type *));
+  } else {
+    size_type NewMapSize{MapSize + std::max(MapSize, NodesToAdd) + 2};
+    Type **map{map_traits::allocate(MapAlloc, NewMapSize)};
+    NewFirst = map + (NewMapSize - NewNodes) / 2 + (AtFront ? NodesToAdd : 0);
+    std::memcpy(static_cast<void *>(NewFirst), static_cast<void *>(First),
+                OldNodes * sizeof(Type *));
+    map_traits::deallocate(MapAlloc, Map, MapSize);
+    Map = map;
+    MapSize = NewMapSize;
+  }
+  Begin = iterator(Begin.GetPointer(), NewFirst);
+  Finish = iterator(Finish.GetPointer(), NewFirst + OldNodes - 1);
+}
+
+template <typename Type, typename Allocator>
+void Deque<Type, Allocator>::ReleaseMap() {
+  if (Map != nullptr) {
+    DeallocateBlock(*GetNode(Finish));
+    map_traits::deallocate(MapAlloc, Map, MapSize);
+    Map = nullptr;
+    MapSize = 0;
+    Begin = iterator();
+    Finish = iterator();
+  }
+}
+
+//  the back block is full: the element goes to its last slot and the next
+//  block is allocated for Finish to point into
+
+template <typename Type, typename Allocator>
+template <class... Args>
+typename Deque<Type, Allocator>::reference
+Deque<Type, Allocator>::EmplaceBackBlock(Args&&... args) {
+  if (Map == nullptr) {
+    InitializeMap();
+    return emplace_back(std::forward<Args>(args)...);
+  }
+  ReserveMap(1, false);
+  Type **Node{GetNode(Finish)};
+  Node[1] = AllocateBlock();
+  Type *Slot{Finish.GetPointer()};
+  try {
+    alloc_traits::construct(Alloc, Slot, std::forward<Args>(args)...);
+  } catch (...) {
+    DeallocateBlock(Node[1]);
+    throw;
+  }
+  Finish = iterator(Node[1], Node + 1);
+  return *Slot;
+}
+
+template <typename Type, typename Allocator>
+template <class... Args>
+typename Deque<Type, Allocator>::reference
+Deque<Type, Allocator>::EmplaceFrontBlock(Args&&... args) {
+  if (Map == nullptr) {
+    InitializeMap();
+    return emplace_front(std::forward<Args>(args)...);
+  }
+  ReserveMap(1, true);
+  Type **Node{GetNode(Begin)};
+  *(Node - 1) = AllocateBlock();
+  Type *Slot{*(Node - 1) + BlockSize - 1};
+  try {
+    alloc_traits::construct(Alloc, Slot, std::forward<Args>(args)...);
+  } catch (...) {
+    DeallocateBlock(*(Node - 1));
+    throw;
+  }
+  Begin = iterator(Slot, Node - 1);
+  return *Slot;
+}
+
+//  keeps the map and the block Finish points into
+
+template <typename Type, typename Allocator>
+void Deque<Type, Allocator>::clear() {
+  while (!empty()) {
+    pop_back();
+  }
+}
+
+template <typename Type, typename Allocator>
+void Deque<Type, Allocator>::swap(Deque &other) {
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    std::swap(Alloc, other.Alloc);
+    std::swap(MapAlloc, other.MapAlloc);
+  }
+  SwapStore(other);
+}
+
+//  the blocks can be taken over only when this allocator is able to free
+//  them, otherwise the elements are moved one by one into blocks of our own
+
+template <typename Type, typename Allocator>
+void Deque<Type, Allocator>::operator=(Deque &&other) noexcept(
+    move_assignment_steals_v<Allocator>) {
+  if (this == &other) {
+    return;
+  }
+  clear();
+  if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+    ReleaseMap();
+    Alloc = other.Alloc;
+    MapAlloc = other.MapAlloc;
+    SwapStore(other);
+  } else if (Alloc == other.Alloc) {
+    ReleaseMap();
+    SwapStore(other);
+  } else {
+    for (auto iter{other.begin()}; iter != other.end(); ++iter) {
+      push_back(std::move(*iter));
+    }
+    other.clear();
+  }
+}
+
+//  the map and the iterators at both ends point into the heap only, so a
+//  deque relocates with a byte copy whenever its allocator does
+
+template <typename Type, typename Allocator>
+struct is_trivially_relocatable<Deque<Type, Allocator>>
+    : is_trivially_relocatable<Allocator> {};
+
+namespace pmr {
+
+template <typename Type>
+using Deque = s21::Deque<Type, std::pmr::polymorphic_allocator<Type>>;
+
+}  // namespace pmr
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_SRC_DEQUE_H_
@@ -0,0 +1,299 @@
+#ifndef CONTAINERS_CPP_SRC_INTRUSIVELIST_H_
+#define CONTAINERS_CPP_SRC_INTRUSIVELIST_H_
+
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+class ListHook;
+
+template <class T, ListHook T::*Member>
+class IntrusiveList;
+
+// Links of an object in an IntrusiveList. The object embeds one hook for
+// every list it may be in at the same time; the hook of an object that is
+// in no list holds null links. A copy of an object is in no list
+class ListHook {
+ public:
+  ListHook() {}
+
+  ListHook(const ListHook&) {}
+
+  ListHook& operator=(const ListHook&) { return *this; }
+
+  bool is_linked() const { return _next != nullptr; }
+
+ private:
+  template <class T, ListHook T::*Member>
+  friend class IntrusiveList;
+
+  ListHook* _next = nullptr;
+  ListHook* _prev = nullptr;
+};
+
+// Doubly-linked list of objects that carry their own links in the hook
+// member Member: insert and erase never allocate, the list never owns,
+// copies or destroys an object, and an object is erased in O(1) given
+// only a reference to it. Like List, the ring of hooks is closed by a
+// sentinel embedded in the list, so end() is the sentinel. An object has
+// to be erased before it is destroyed and can be in one list per hook.
+// T has to be a standard-layout class, so the hook sits at a fixed offset
+// the list can step back over:
+//
+//   struct Timer {
+//     ListHook Hook;
+//   };
+//   IntrusiveList<Timer, &Timer::Hook> Timers;
+template <class T, ListHook T::*Member>
+class IntrusiveList {
+  static_assert(std::is_standard_layout_v<T>,
+                "IntrusiveList needs a standard-layout T");
+
+ public:
+  class IntrusiveListIterator;
+
+  typedef T value_type;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef IntrusiveListIterator iterator;
+  typedef size_t size_type;
+
+  IntrusiveList() { ResetSentinel(); }
+
+  IntrusiveList(const IntrusiveList& other) = delete;
+
+  IntrusiveList(IntrusiveList&& other) noexcept {
+    ResetSentinel();
+    Take(other);
+  }
+
+  ~IntrusiveList() { clear(); }
+
+  IntrusiveList& operator=(const IntrusiveList& other) = delete;
+
+  void operator=(IntrusiveList&& other) noexcept {
+    if (this != &other) {
+      clear();
+      Take(other);
+    }
+  }
+
+  /// methods
+
+  // links value in front of pos, value must not be in a list by this hook
+  iterator insert(iterator pos, reference value) {
+    ListHook* hook = HookOf(value);
+    LinkBefore(pos.GetPointer(), hook);
+    return iterator(hook);
+  }
+
+  // unlinks the object at pos, returns the iterator after it
+  iterator erase(iterator pos) {
+    ListHook* next = pos.GetPointer()->_next;
+    Unlink(pos.GetPointer());
+    return iterator(next);
+  }
+
+  // unlinks value from this list, O(1)
+  void erase(reference value) { Unlink(HookOf(value)); }
+
+  void push_back(reference value) { LinkBefore(&_sentinel, HookOf(value)); }
+
+  void push_front(reference value) {
+    LinkBefore(_sentinel._next, HookOf(value));
+  }
+
+  void pop_back() {
+    if (!empty()) {
+      Unlink(_sentinel._prev);
+    }
+  }
+
+  void pop_front() {
+    if (!empty()) {
+      Unlink(_sentinel._next);
+    }
+  }
+
+  // front and back expect a non-empty list
+  reference front() { return *Owner(_sentinel._next); }
+
+  reference back() { return *Owner(_sentinel._prev); }
+
+  bool empty() const { return _size == 0; }
+
+  size_type size() const { return _size; }
+
+  // unlinks every object, O(N): their hooks are reset
+  void clear() {
+    ListHook* hook = _sentinel._next;
+    while (hook != &_sentinel) {
+      ListHook* next = hook->_next;
+      hook->_next = nullptr;
+      hook->_prev = nullptr;
+      hook = next;
+    }
+    ResetSentinel();
+  }
+
+  void swap(IntrusiveList& other) {
+    IntrusiveList held(std::move(other));
+    other.Take(*this);
+    Take(held);
+  }
+
+  // moves all objects of other in front of pos, O(1)
+  void splice(iterator pos, IntrusiveList& other) {
+    if (this == &other || other._size == 0) {
+      return;
+    }
+    Transfer(pos.GetPointer(), other._sentinel._next, &other._sentinel);
+    _size += other._size;
+    other._size = 0;
+  }
+
+  // moves the object at it of other in front of pos, O(1)
+  void splice(iterator pos, IntrusiveList& other, iterator it) {
+    ListHook* hook = it.GetPointer();
+    if (hook == pos.GetPointer() || hook->_next == pos.GetPointer()) {
+      return;
+    }
+    Transfer(pos.GetPointer(), hook, hook->_next);
+    other._size--;
+    _size++;
+  }
+
+  // the iterator of value, which has to be in this list
+  iterator iterator_to(reference value) { return iterator(HookOf(value)); }
+
+  /// iterators
+
+  class IntrusiveListIterator {
+   public:
+    typedef std::bidirectional_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T* pointer;
+    typedef T& reference;
+
+    IntrusiveListIterator() {}
+
+    explicit IntrusiveListIterator(ListHook* ptr) : _ptr(ptr) {}
+
+    reference operator*() const { return *Owner(_ptr); }
+
+    pointer operator->() const { return Owner(_ptr); }
+
+    IntrusiveListIterator& operator++() {
+      _ptr = _ptr->_next;
+      return *this;
+    }
+
+    IntrusiveListIterator operator++(int) {
+      IntrusiveListIterator old = *this;
+      _ptr = _ptr->_next;
+      return old;
+    }
+
+    IntrusiveListIterator& operator--() {
+      _ptr = _ptr->_prev;
+      return *this;
+    }
+
+    IntrusiveListIterator operator--(int) {
+      IntrusiveListIterator old = *this;
+      _ptr = _ptr->_prev;
+      return old;
+    }
+
+    bool operator==(const IntrusiveListIterator& other) const {
+      return _ptr == other._ptr;
+    }
+
+    ListHook* GetPointer() const { return _ptr; }
+
+   private:
+    ListHook* _ptr = nullptr;
+  };
+
+  iterator begin() { return iterator(_sentinel._next); }
+
+  iterator end() { return iterator(&_sentinel); }
+
+ private:
+  ListHook _sentinel;
+
+  size_type _size = 0;
+
+  static ListHook* HookOf(reference value) { return &(value.*Member); }
+
+  // the object around a hook. A pointer to a data member of a class with
+  // no virtual bases holds the member's offset (Itanium and MSVC ABIs, as
+  // in Boost.Intrusive), so no object is needed to read it
+  static T* Owner(ListHook* hook) {
+    static_assert(sizeof(Member) == sizeof(std::ptrdiff_t) ||
+                  sizeof(Member) == sizeof(int));
+    std::ptrdiff_t offset;
+    if constexpr (sizeof(Member) == sizeof(std::ptrdiff_t)) {
+      offset = std::bit_cast<std::ptrdiff_t>(Member);
+    } else {
+      offset = std::bit_cast<int>(Member);
+    }
+    return reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(hook) -
+                                offset);
+  }
+
+  void LinkBefore(ListHook* pos, ListHook* hook) {
+    hook->_next = pos;
+    hook->_prev = pos->_prev;
+    pos->_prev->_next = hook;
+    pos->_prev = hook;
+    _size++;
+  }
+
+  void Unlink(ListHook* hook) {
+    hook->_prev->_next = hook->_next;
+    hook->_next->_prev = hook->_prev;
+    hook->_next = nullptr;
+    hook->_prev = nullptr;
+    _size--;
+  }
+
+  void ResetSentinel() {
+    _sentinel._next = &_sentinel;
+    _sentinel._prev = &_sentinel;
+    _size = 0;
+  }
+
+  // takes all objects of other, this list has to be empty
+  void Take(IntrusiveList& other) {
+    if (other._size == 0) {
+      return;
+    }
+    _sentinel._next = other._sentinel._next;
+    _sentinel._prev = other._sentinel._prev;
+    _sentinel._next->_prev = &_sentinel;
+    _sentinel._prev->_next = &_sentinel;
+    _size = other._size;
+    other.ResetSentinel();
+  }
+
+  // moves the hooks [first, last) in front of pos, O(1)
+  static void Transfer(ListHook* pos, ListHook* first, ListHook* last) {
+    ListHook* tail = last->_prev;
+    first->_prev->_next = last;
+    last->_prev = first->_prev;
+    tail->_next = pos;
+    first->_prev = pos->_prev;
+    pos->_prev->_next = first;
+    pos->_prev = tail;
+  }
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_SRC_INTRUSIVELIST_H_
@@ -1,153 +1,270 @@
 #pragma once
+#include <algorithm>
 #include <cmath>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "relocate.h"
 
 namespace s21 {
-template <typename T>
+// Nodes form a ring closed by a sentinel embedded in the list itself: end()
+// is the sentinel, an empty list allocates nothing and a move hands the
+// nodes over by relinking the two ends. Allocator is rebound to the node
+// type; with PoolAllocator nodes are carved out of contiguous chunks and
+// clear() hands the chunks back in one go
+template <typename T, typename Allocator = std::allocator<T>>
 class List {
  public:
   class ListIterator;
 
- private:
   typedef T value_type;
   typedef T& reference;
   typedef const T& const_reference;
   typedef ListIterator iterator;
   typedef const ListIterator const_iterator;
   typedef size_t size_type;
+  typedef Allocator allocator_type;
+
+ private:
+  struct NodeBase {
+    NodeBase* _next;
+    NodeBase* _prev;
+  };
+
+  struct Node : NodeBase {
+    template <class... Args>
+    explicit Node(Args&&... args)
+        : NodeBase{nullptr, nullptr}, _value(std::forward<Args>(args)...) {}
 
-  struct Node {
     value_type _value;
-    Node* _next = nullptr;
-    Node* _prev = nullptr;
   };
 
-  Node* _first = nullptr;
-  Node* _end = nullptr;
-  Node* _head = nullptr;
+  typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Node>
+      node_allocator;
+  typedef std::allocator_traits<node_allocator> node_traits;
+
+  NodeBase _sentinel{&_sentinel, &_sentinel};
+
+  size_type _size = 0;
+
+  node_allocator _alloc;
+
+  static value_type& Value(NodeBase* node) {
+    return static_cast<Node*>(node)->_value;
+  }
+
+  template <class... Args>
+  Node* CreateNode(Args&&... args) {
+    Node* node = node_traits::allocate(_alloc, 1);
+    try {
+      node_traits::construct(_alloc, node, std::forward<Args>(args)...);
+    } catch (...) {
+      node_traits::deallocate(_alloc, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  void DestroyNode(NodeBase* node) {
+    Node* owned = static_cast<Node*>(node);
+    node_traits::destroy(_alloc, owned);
+    node_traits::deallocate(_alloc, owned, 1);
+  }
+
+  // links node in front of pos
+  void LinkBefore(NodeBase* pos, NodeBase* node) {
+    node->_next = pos;
+    node->_prev = pos->_prev;
+    pos->_prev->_next = node;
+    pos->_prev = node;
+    _size++;
+  }
 
-  int _size = 0;
+  void ResetSentinel() {
+    _sentinel._next = &_sentinel;
+    _sentinel._prev = &_sentinel;
+    _size = 0;
+  }
+
+  // takes all nodes of other, this list has to be empty
+  void Take(List& other) {
+    if (other._size == 0) {
+      return;
+    }
+    _sentinel._next = other._sentinel._next;
+    _sentinel._prev = other._sentinel._prev;
+    _sentinel._next->_prev = &_sentinel;
+    _sentinel._prev->_next = &_sentinel;
+    _size = other._size;
+    other.ResetSentinel();
+  }
 
-  void InitList() {
-    _first = new Node;
-    _end = new Node;
-    _first->_next = _end;
-    _end->_prev = _first;
+  // moves the nodes [first, last) in front of pos, O(1)
+  static void Transfer(NodeBase* pos, NodeBase* first, NodeBase* last) {
+    NodeBase* tail = last->_prev;
+    first->_prev->_next = last;
+    last->_prev = first->_prev;
+    tail->_next = pos;
+    first->_prev = pos->_prev;
+    pos->_prev->_next = first;
+    pos->_prev = tail;
+  }
+
+  // a node can change lists only when this allocator is able to free it,
+  // otherwise its value is moved into a node of our own
+  NodeBase* Adopt(List& other, NodeBase* node) {
+    if (_alloc == other._alloc) {
+      return node;
+    }
+    Node* adopted = CreateNode(std::move(Value(node)));
+    other.DestroyNode(node);
+    return adopted;
+  }
+
+  // merges the null-terminated sorted chain later into earlier, stable:
+  // of equal values the ones of earlier come first. If comp throws,
+  // earlier keeps every node of both chains
+  template <class Compare>
+  static void MergeChains(NodeBase*& earlier, NodeBase* later,
+                          Compare& comp) {
+    NodeBase* left = earlier;
+    NodeBase* merged = nullptr;
+    NodeBase** link = &merged;
+    try {
+      while (left != nullptr && later != nullptr) {
+        if (comp(Value(later), Value(left))) {
+          *link = later;
+          later = later->_next;
+        } else {
+          *link = left;
+          left = left->_next;
+        }
+        link = &(*link)->_next;
+      }
+    } catch (...) {
+      *link = left;
+      while (*link != nullptr) link = &(*link)->_next;
+      *link = later;
+      earlier = merged;
+      throw;
+    }
+    *link = left != nullptr ? left : later;
+    earlier = merged;
+  }
+
+  // closes the null-terminated chain into the ring of the sentinel and
+  // restores the _prev links
+  void AttachChain(NodeBase* chain) {
+    NodeBase* prev = &_sentinel;
+    for (NodeBase* node = chain; node != nullptr; node = node->_next) {
+      node->_prev = prev;
+      prev->_next = node;
+      prev = node;
+    }
+    prev->_next = &_sentinel;
+    _sentinel._prev = prev;
+  }
+
+  // bulk release is only possible when nodes need no destructor calls and
+  // the allocator can drop all of its memory at once
+  bool ReleaseAll() {
+    bool released = false;
+    if constexpr (std::is_trivially_destructible_v<Node> &&
+                  requires(node_allocator alloc) { alloc.release(); }) {
+      released = _alloc.release();
+    }
+    return released;
   }
 
  public:
-  List() { this->InitList(); }
+  List() {}
+
+  explicit List(const allocator_type& alloc) : _alloc(alloc) {}
 
   // без префикса explicit т.к. в тестах используется конвертация из такой
   // конструкции: {double, double ,etc} в initializer list
   List(std::initializer_list<value_type> const& items) {
-    this->InitList();
     for (value_type value : items) {
       this->push_back(value);
-      _size++;
     }
   }
 
-  List(List const& other) { *this = other; }
+  List(List const& other)
+      : _alloc(node_traits::select_on_container_copy_construction(
+            other._alloc)) {
+    *this = other;
+  }
 
   explicit List(size_type size) {
-    InitList();
-    for (int i = 0; i < size; i++) {
+    for (size_type i = 0; i < size; i++) {
       push_back();
     }
-    _size = size;
   }
 
-  List(List&& other) {
-    this->clear();
-    _head = other._head;
-    _first = other._first;
-    _end = other._end;
-    _size = other._size;
-
-    other._head = nullptr;
-    other._first = nullptr;
-    other._end = nullptr;
-    other._size = 0;
-  }
+  List(List&& other) noexcept : _alloc(other._alloc) { Take(other); }
 
-  ~List() {
-    Node* r = _first;
-    if (r != nullptr) {
-      // delete _end;
-      while (r != nullptr) {
-        Node* temp = r;
-        r = r->_next;
-        delete temp;
-      }
-      _head = nullptr;
-      _size = 0;
-    }
-  }
+  ~List() { clear(); }
 
   void operator=(List const& other) {
+    if (this == &other) {
+      return;
+    }
     this->clear();
-    this->InitList();
-    Node* r = other._head;
-    while (r != other._end) {
-      push_back(r->_value);
-      r = r->_next;
+    for (NodeBase* r = other._sentinel._next; r != &other._sentinel;
+         r = r->_next) {
+      push_back(Value(r));
     }
-
-    _size = other._size;
   }
 
-  void operator=(List&& other) {
+  // the nodes change owners only when this allocator can free them,
+  // otherwise the values are moved into nodes of our own
+  void operator=(List&& other) noexcept(move_assignment_steals_v<Allocator>) {
+    if (this == &other) {
+      return;
+    }
     this->clear();
-    this->InitList();
-    Node* r = other._head;
-    while (r != other._end) {
-      push_back(r->_value);
-      r = r->_next;
+    if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+      _alloc = other._alloc;
+      Take(other);
+    } else if (_alloc == other._alloc) {
+      Take(other);
+    } else {
+      for (NodeBase* r = other._sentinel._next; r != &other._sentinel;
+           r = r->_next) {
+        LinkBefore(&_sentinel, CreateNode(std::move(Value(r))));
+      }
+      other.clear();
     }
-    _size = other._size;
-    other.clear();
   }
 
   /// methods
 
   iterator insert(iterator pos, const_reference value) {
-    Node* ptr = pos.GetPointer();
+    NodeBase* ptr = pos.GetPointer();
     if (ptr == nullptr)
       throw std::out_of_range("insert : iterator point to null");
-    Node* elemNew = new Node;
-    elemNew->_value = value;
-    elemNew->_next = ptr;
-    elemNew->_prev = ptr->_prev;
-    ptr->_prev->_next = elemNew;
-    ptr->_prev = elemNew;
-    if (ptr == _head) _head = elemNew;
-    _size++;
+    LinkBefore(ptr, CreateNode(value));
     return iterator(--pos);
   }
 
   void erase(iterator pos) {
-    Node *ptr = pos.GetPointer(), *del;
-    if (ptr == nullptr)
+    NodeBase* ptr = pos.GetPointer();
+    if (ptr == nullptr || ptr == &_sentinel)
       throw std::out_of_range("insert : iterator point to null");
-    if (ptr == _head) {
-      _head = ptr->_next;
-      del = ptr;
-      ptr->_prev->_next = ptr->_next;
-      ptr->_next->_prev = ptr->_prev;
-    } else {
-      del = ptr;
-      ptr->_prev->_next = ptr->_next;
-      ptr->_next->_prev = ptr->_prev;
-    }
+    ptr->_prev->_next = ptr->_next;
+    ptr->_next->_prev = ptr->_prev;
     _size--;
-    if (_size == 0) _head = nullptr;
-    delete del;
+    DestroyNode(ptr);
   }
 
   void pop_back() {
     if (!this->empty()) {
-      List<value_type>::iterator end = this->end();
+      iterator end = this->end();
       --end;
       this->erase(end);
     }
@@ -155,178 +272,266 @@ class List {
 
   void pop_front() {
     if (!this->empty()) {
-      List<value_type>::iterator begin = this->begin();
+      iterator begin = this->begin();
       this->erase(begin);
     }
   }
 
+  // exchanges the rings through a sentinel on the stack, O(1)
   void swap(List& other) {
-    Node *swapH = _head, *swapE = _end, *swapF = _first;
-    int swapS = _size;
-    _head = other._head;
-    _end = other._end;
-    _first = other._first;
-    _size = other._size;
-    other._head = swapH;
-    other._end = swapE;
-    other._first = swapF;
-    other._size = swapS;
+    List held(std::move(other));
+    other.Take(*this);
+    Take(held);
+    if constexpr (node_traits::propagate_on_container_swap::value) {
+      std::swap(_alloc, other._alloc);
+    }
   }
 
-  void merge(List& other) {
-    List<value_type>::iterator iter = other.begin(), end = other.end();
-    for (; iter != end; ++iter) {
-      this->push_back(*iter);
+  // merges the sorted other into this sorted list by relinking its nodes,
+  // stable: of equal values the ones of this list come first
+  void merge(List& other) { merge(other, std::less<>()); }
+
+  template <class Compare>
+  void merge(List& other, Compare comp) {
+    if (this == &other || other._size == 0) {
+      return;
+    }
+    NodeBase* pos = _sentinel._next;
+    NodeBase* node = other._sentinel._next;
+    while (node != &other._sentinel) {
+      NodeBase* next = node->_next;
+      while (pos != &_sentinel && !comp(Value(node), Value(pos))) {
+        pos = pos->_next;
+      }
+      if (_alloc == other._alloc) {
+        Transfer(pos, node, next);
+        _size++;
+      } else {
+        LinkBefore(pos, CreateNode(std::move(Value(node))));
+        node->_prev->_next = next;
+        next->_prev = node->_prev;
+        other.DestroyNode(node);
+      }
+      other._size--;
+      node = next;
     }
   }
 
+  // moves all nodes of other in front of pos, O(1)
   void splice(const_iterator pos, List& other) {
-    List<value_type>::iterator end = other.end(), iter = other.begin(),
-                               temp = pos;
-    for (; iter != end; ++iter) {
-      insert(pos, *iter);
+    if (this == &other || other._size == 0) {
+      return;
+    }
+    iterator position = pos;
+    NodeBase* target = position.GetPointer() == nullptr
+                           ? &_sentinel
+                           : position.GetPointer();
+    if (_alloc == other._alloc) {
+      Transfer(target, other._sentinel._next, &other._sentinel);
+      _size += other._size;
+      other._size = 0;
+    } else {
+      while (other._size != 0) {
+        splice(pos, other, other.begin());
+      }
     }
   }
 
+  // moves the node at it of other in front of pos, O(1)
+  void splice(const_iterator pos, List& other, const_iterator it) {
+    iterator position = pos, element = it;
+    NodeBase* target = position.GetPointer() == nullptr
+                           ? &_sentinel
+                           : position.GetPointer();
+    NodeBase* node = element.GetPointer();
+    if (node == target || node->_next == target) {
+      return;
+    }
+    NodeBase* next = node->_next;
+    node->_prev->_next = next;
+    next->_prev = node->_prev;
+    other._size--;
+    LinkBefore(target, Adopt(other, node));
+  }
+
+  // swaps the links of every node in place, the sentinel included
   void reverse() {
-    List<value_type> newList;
-    List<value_type>::iterator iter = this->end(), start = this->begin();
-    --start;
-    --iter;
-    for (; iter != start; --iter) {
-      newList.push_back(*iter);
-    }
-    *this = newList;
-  }
-
-  void unique() {
-    List<value_type>::iterator iter = this->begin(), end = this->end();
-    for (; iter != end; ++iter) {
-      bool uniq = true;
-      for (List<value_type>::iterator iter2 = iter + 1; uniq && iter2 != end;
-           ++iter2) {
-        if (*iter2 == *iter) {
-          --iter;
-          uniq = false;
-          this->erase(iter2);
-        }
+    NodeBase* node = &_sentinel;
+    do {
+      std::swap(node->_next, node->_prev);
+      node = node->_prev;
+    } while (node != &_sentinel);
+  }
+
+  // removes all but the first of every run of equal adjacent values, O(N)
+  void unique() { unique(std::equal_to<>()); }
+
+  template <class BinaryPredicate>
+  void unique(BinaryPredicate equal) {
+    if (_size < 2) {
+      return;
+    }
+    NodeBase* node = _sentinel._next;
+    while (node->_next != &_sentinel) {
+      NodeBase* next = node->_next;
+      if (equal(Value(node), Value(next))) {
+        node->_next = next->_next;
+        next->_next->_prev = node;
+        DestroyNode(next);
+        _size--;
+      } else {
+        node = next;
       }
     }
   }
 
-  void sort();
-
-  void push_back() {
-    if (_first == nullptr) {
-      this->InitList();
-    }
-    Node* elemNew = new Node;
-    if (_head == nullptr) {
-      _head = elemNew;
-      _head->_prev = _first;
-      _head->_next = _end;
-      _first->_next = _head;
-      _end->_prev = _head;
-    } else {
-      Node* last = _end->_prev;
-      elemNew->_prev = last;
-      elemNew->_next = _end;
-      last->_next = elemNew;
-      _end->_prev = elemNew;
+  // bottom-up merge sort, stable and O(N log N) with no allocation: sorted
+  // chains of 2^i nodes wait in runs[i] and equal sizes are merged like the
+  // carries of a binary counter. The _prev links are rebuilt at the end.
+  // If comp throws, every node stays in the list in some order
+  void sort() { sort(std::less<>()); }
+
+  template <class Compare>
+  void sort(Compare comp) {
+    if (_size < 2) {
+      return;
+    }
+    NodeBase* runs[64] = {};
+    NodeBase* input = _sentinel._next;
+    _sentinel._prev->_next = nullptr;
+    try {
+      while (input != nullptr) {
+        NodeBase* carry = input;
+        input = input->_next;
+        carry->_next = nullptr;
+        size_type i = 0;
+        for (; runs[i] != nullptr; i++) {
+          NodeBase* later = carry;
+          carry = nullptr;
+          MergeChains(runs[i], later, comp);
+          carry = runs[i];
+          runs[i] = nullptr;
+        }
+        runs[i] = carry;
+      }
+      NodeBase* result = nullptr;
+      for (size_type i = 0; i < 64; i++) {
+        if (runs[i] != nullptr) {
+          MergeChains(runs[i], result, comp);
+          result = runs[i];
+          runs[i] = nullptr;
+        }
+      }
+      AttachChain(result);
+    } catch (...) {
+      NodeBase* chain = input;
+      for (NodeBase* run : runs) {
+        if (run != nullptr) {
+          NodeBase* tail = run;
+          while (tail->_next != nullptr) tail = tail->_next;
+          tail->_next = chain;
+          chain = run;
+        }
+      }
+      AttachChain(chain);
+      throw;
     }
   }
 
+  // moves the values into new nodes and links those in address order, so
+  // a scan of a list scattered by inserts, erases and relinking walks
+  // memory forward again. Needs room for a second set of nodes while it
+  // runs and invalidates every iterator; if an allocation or a copy
+  // throws, the list is left as it was
+  void compact() {
+    if (_size < 2) {
+      return;
+    }
+    typedef typename node_traits::template rebind_alloc<Node*>
+        pointer_allocator;
+    std::vector<Node*, pointer_allocator> nodes((pointer_allocator(_alloc)));
+    nodes.reserve(_size);
+    size_type built = 0;
+    try {
+      for (size_type i = 0; i < _size; i++) {
+        nodes.push_back(node_traits::allocate(_alloc, 1));
+      }
+      std::sort(nodes.begin(), nodes.end(), std::less<Node*>());
+      for (NodeBase* node = _sentinel._next; node != &_sentinel;
+           node = node->_next, built++) {
+        node_traits::construct(_alloc, nodes[built],
+                               std::move_if_noexcept(Value(node)));
+      }
+    } catch (...) {
+      for (size_type i = 0; i < nodes.size(); i++) {
+        if (i < built) {
+          node_traits::destroy(_alloc, nodes[i]);
+        }
+        node_traits::deallocate(_alloc, nodes[i], 1);
+      }
+      throw;
+    }
+    NodeBase* node = _sentinel._next;
+    while (node != &_sentinel) {
+      NodeBase* next = node->_next;
+      DestroyNode(node);
+      node = next;
+    }
+    NodeBase* prev = &_sentinel;
+    for (size_type i = 0; i < nodes.size(); i++) {
+      prev->_next = nodes[i];
+      nodes[i]->_prev = prev;
+      prev = nodes[i];
+    }
+    prev->_next = &_sentinel;
+    _sentinel._prev = prev;
+  }
+
+  void push_back() { LinkBefore(&_sentinel, CreateNode()); }
+
   void push_back(value_type value) {
-    if (_first == nullptr) {
-      this->InitList();
-    }
-    Node* elemNew = new Node;
-    elemNew->_value = value;
-    if (_head == nullptr) {
-      _head = elemNew;
-      _head->_prev = _first;
-      _head->_next = _end;
-      _first->_next = _head;
-      _end->_prev = _head;
-    } else {
-      Node* last = _end->_prev;
-      elemNew->_prev = last;
-      elemNew->_next = _end;
-      last->_next = elemNew;
-      _end->_prev = elemNew;
-    }
+    LinkBefore(&_sentinel, CreateNode(std::move(value)));
   }
 
   void push_front(value_type value) {
-    if (_first == nullptr) {
-      this->InitList();
-    }
-    Node* elemNew = new Node;
-    elemNew->_value = value;
-    if (_head == nullptr) {
-      _head = elemNew;
-      _head->_prev = _first;
-      _head->_next = _end;
-      _first->_next = _head;
-      _end->_prev = _head;
-    } else {
-      elemNew->_next = _head;
-      elemNew->_prev = _first;
-      _first->_next = elemNew;
-      _head->_prev = elemNew;
-      _head = elemNew;
-    }
+    LinkBefore(_sentinel._next, CreateNode(std::move(value)));
   }
 
-  bool empty() {
-    bool res = false;
-    if (_head == nullptr) {
-      res = true;
-    }
-    return res;
-  }
+  bool empty() { return _size == 0; }
 
-  const_reference back() {
-    if (this->empty() == false) {
-      return _end->_prev->_value;
-    }
-    return _end->_value;
-  }
+  // front and back expect a non-empty list
+  reference back() { return Value(_sentinel._prev); }
 
-  const_reference front() {
-    if (this->empty() == false) {
-      return _head->_value;
-    }
-    return _first->_value;
-  }
+  reference front() { return Value(_sentinel._next); }
 
   void clear() {
-    Node* ptr = _first;
-    while (ptr != nullptr) {
-      Node* del = ptr;
-      ptr = ptr->_next;
-      delete del;
-    }
-    _head = nullptr;
-    _first = nullptr;
-    _end = nullptr;
-    _size = 0;
+    if (!ReleaseAll()) {
+      NodeBase* ptr = _sentinel._next;
+      while (ptr != &_sentinel) {
+        NodeBase* del = ptr;
+        ptr = ptr->_next;
+        DestroyNode(del);
+      }
+    }
+    ResetSentinel();
   }
 
   size_type size() { return _size; }
 
   size_type max_size() { return pow(2, 32) - 1; }
 
+  allocator_type get_allocator() { return allocator_type(_alloc); }
+
   /// iterators
 
   class ListIterator {
    private:
-    Node* _ptr = nullptr;
+    NodeBase* _ptr = nullptr;
     int _pos = 0;
 
    public:
     ListIterator() {}
-    ListIterator(Node* ptr, int pos) {
+    ListIterator(NodeBase* ptr, int pos) {
       _ptr = ptr;
       _pos = pos;
     }
@@ -429,24 +634,25 @@ class List {
         throw std::out_of_range(
             "operator *: iterator is pointing to null element");
       }
-      return _ptr->_value;
+      return Value(_ptr);
     }
 
-    Node* GetPointer() { return _ptr; }
+    NodeBase* GetPointer() { return _ptr; }
   };
   iterator begin() {
-    iterator ret(_head, 0);
+    iterator ret(_sentinel._next, 0);
     return ret;
   }
   iterator end() {
-    iterator ret(_end, _size);
+    iterator ret(&_sentinel, _size);
     return ret;
   }
 
   /// auxiliary
   void show() {
-    for (Node* temp = _head; temp != _end; temp = temp->_next) {
-      std::cout << temp->_value << std::endl;
+    for (NodeBase* temp = _sentinel._next; temp != &_sentinel;
+         temp = temp->_next) {
+      std::cout << Value(temp) << std::endl;
     }
   }
 
@@ -481,4 +687,9 @@ class List {
   }
 };
 
+namespace pmr {
+template <typename T>
+using List = s21::List<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+
 }  // namespace s21
\ No newline at end of file
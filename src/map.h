@@ -5,14 +5,23 @@
 #ifndef CONTAINERS_CPP_SRC_MAP_H_
 #define CONTAINERS_CPP_SRC_MAP_H_
 
+#include <algorithm>
+#include <bit>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <memory_resource>
+#include <stdexcept>
 #include <string>
 
+#include "red_black_tree.h"
+#include "static_search_tree.h"
 #include "vector.h"
 
 namespace s21 {
-template <typename Key, typename T>
+template <typename Key, typename T,
+          typename Allocator = std::allocator<std::pair<Key, T>>>
 class Map {
  public:
   typedef Key key_type;
@@ -20,95 +29,122 @@ class Map {
   typedef std::pair<key_type, mapped_type> value_type;
   typedef value_type& reference;
   typedef size_t size_type;
+  typedef Allocator allocator_type;
+  typedef RedBlackTree<key_type, mapped_type, allocator_type> tree_type;
+  typedef typename tree_type::Node node_type;
+  typedef StaticSearchTree<key_type, node_type*, allocator_type> index_type;
 
  public:
+  //  Iterator walks the tree in key order; the iterator after the last
+  //  element holds no node and compares greater than any other
+
   class MapIterator {
    public:
     MapIterator() {}
 
+    MapIterator(node_type* initNode, const tree_type* initTree)
+        : node(initNode), tree(initTree) {}
+
     MapIterator(const MapIterator& other) {
-      pointer = other.pointer;
-      position = other.position;
+      node = other.node;
+      tree = other.tree;
     }
 
-    void SetIterator(std::shared_ptr<value_type[]> newPointer) {
-      pointer = newPointer;
+    MapIterator& operator=(const MapIterator& other) {
+      node = other.node;
+      tree = other.tree;
+      return *this;
     }
 
-    value_type& operator*() { return pointer[position]; }
+    value_type& operator*() { return node->_value; }
 
-    void operator++() { position += 1; }
+    value_type* operator->() { return &node->_value; }
 
-    void operator--() { position -= 1; }
+    void operator++() { node = tree_type::Next(node); }
 
-    size_type GetPosition() { return position; }
-
-    bool operator==(const MapIterator other) {
-      return position == other.position;
+    void operator--() {
+      node = node == nullptr ? tree->Last() : tree_type::Prev(node);
     }
 
-    bool operator!=(const MapIterator other) {
-      return position != other.position;
-    }
+    bool operator==(const MapIterator other) { return node == other.node; }
+
+    bool operator!=(const MapIterator other) { return node != other.node; }
 
     bool operator>=(const MapIterator other) {
-      return position >= other.position;
+      return node == nullptr ||
+             (other.node != nullptr &&
+              !(node->_value.first < other.node->_value.first));
     }
 
     bool operator<=(const MapIterator other) {
-      return position <= other.position;
+      return other.node == nullptr ||
+             (node != nullptr &&
+              !(other.node->_value.first < node->_value.first));
     }
 
-    void Advance(size_t repeat) { position += repeat; }
+    void Advance(size_t repeat) {
+      for (size_t i{0}; i < repeat; i++) ++*this;
+    }
 
-    void Decrease(size_t repeat) { position -= repeat; }
+    void Decrease(size_t repeat) {
+      for (size_t i{0}; i < repeat; i++) --*this;
+    }
 
     void swap(MapIterator& other) {
-      pointer.swap(other.pointer);
-      std::swap(position, other.position);
+      std::swap(node, other.node);
+      std::swap(tree, other.tree);
     }
 
-    void copy(const MapIterator other) { position = other.position; }
+    node_type* GetNode() { return node; }
 
    private:
-    std::shared_ptr<value_type[]> pointer;
-    size_type position{};
+    node_type* node{nullptr};
+    const tree_type* tree{nullptr};
   };
 
   typedef MapIterator iterator;
   typedef std::pair<iterator, bool> isInserted;
-  typedef std::pair<size_type, bool> isFound;
+  typedef std::pair<iterator, bool> isFound;
+
+  Map() {}
+
+  explicit Map(const allocator_type& alloc) : Store(alloc), Index(alloc) {}
 
-  Map() {
-    EndIterator.SetIterator(Store);
-    BeginIterator.SetIterator(Store);
+  Map(std::initializer_list<value_type> const& items,
+      const allocator_type& alloc = allocator_type())
+      : Store(alloc), Index(alloc) {
+    insert(items.begin(), items.end());
   }
 
-  Map(std::initializer_list<value_type> const& items) {
-    Store.reset(new value_type[MapMaxSize]{});
-    BeginIterator.SetIterator(Store);
-    EndIterator.SetIterator(Store);
-    for (auto iter{items.begin()}; iter != items.end(); iter++) {
-      insert(*iter);
-    }
+  template <class InputIt>
+    requires std::input_iterator<InputIt>
+  Map(InputIt first, InputIt last,
+      const allocator_type& alloc = allocator_type())
+      : Store(alloc), Index(alloc) {
+    insert(first, last);
   }
 
-  Map(const Map& other) {
-    MapSize = other.MapSize;
-    MapMaxSize = other.MapMaxSize;
-    Store.reset(new value_type[MapMaxSize]{});
-    for (int i{0}; i < MapSize; i++) {
-      Store[i] = other.Store[i];
-    }
-    BeginIterator.SetIterator(Store);
-    BeginIterator.copy(other.BeginIterator);
-    EndIterator.SetIterator(Store);
-    EndIterator.copy(other.EndIterator);
+  //  builds a map from values ordered by non-decreasing key in O(N),
+  //  throws std::invalid_argument when they are not ordered
+
+  template <class ForwardIt>
+    requires std::forward_iterator<ForwardIt>
+  static Map from_sorted(ForwardIt first, ForwardIt last,
+                         const allocator_type& alloc = allocator_type());
+
+  Map(const Map& other)
+      : Store(other.Store), Index(Store.GetAllocator()) {}
+
+  Map(Map&& other) noexcept
+      : Store(std::move(other.Store)),
+        Index(std::move(other.Index)),
+        Frozen(other.Frozen) {
+    other.Frozen = false;
   }
 
-  Map(Map&& other) { swap(other); }
+  //  takes the nodes of other over; both maps end up thawed
 
-  void operator=(Map&& other);
+  void operator=(Map&& other) noexcept(move_assignment_steals_v<Allocator>);
 
   isInserted insert(const value_type& value);
 
@@ -116,23 +152,41 @@ class Map {
 
   isInserted insert_or_assign(const value_type& value);
 
+  //  inserts a batch at once: an unordered batch is copied and stably
+  //  sorted, then merged with the tree in one linear pass, so loading N
+  //  values costs O(N log N). Of equal keys the first one wins, as with
+  //  insert of one value
+
+  template <class InputIt>
+    requires std::input_iterator<InputIt>
+  void insert(InputIt first, InputIt last);
+
   void clear();
 
   void erase(iterator position);
 
   void swap(Map& other);
 
+  //  moves the elements of other whose keys are missing here, as
+  //  std::map::merge does: elements with keys present in both stay in
+  //  other. One linear pass over both trees, nodes change owners without
+  //  copies
+
   void merge(Map& other);
 
-  bool empty() { return MapSize == 0; }
+  bool empty() { return Store.Size() == 0; }
 
-  size_type size() { return MapSize; }
+  size_type size() { return Store.Size(); }
+
+  size_type max_size() {
+    return std::numeric_limits<size_type>::max() / sizeof(node_type);
+  }
 
-  size_type max_size() { return MapMaxSize; }
+  iterator begin() { return iterator(Store.First(), &Store); }
 
-  iterator begin() { return BeginIterator; }
+  //  iterator to the last element, as before the tree-based store
 
-  iterator end() { return EndIterator; }
+  iterator end() { return iterator(Store.Last(), &Store); }
 
   bool contains(const key_type& key) { return FindPosition(key).second; }
 
@@ -142,6 +196,24 @@ class Map {
 
   mapped_type& operator[](const key_type& key);
 
+  allocator_type get_allocator() { return Store.GetAllocator(); }
+
+  //  read-optimized mode: Freeze builds a StaticSearchTree over the keys
+  //  and FindPosition, at, contains and the lookup of operator[] search it
+  //  instead of the tree until the next insert or erase drops it. Values
+  //  stay in the tree nodes, so changing a mapped value keeps the map frozen
+
+  void Freeze();
+
+  void Thaw() {
+    if (Frozen) {
+      Index.Clear();
+      Frozen = false;
+    }
+  }
+
+  bool IsFrozen() { return Frozen; }
+
   void emplace_back() {}
   template <class Type, class... Args>
   Vector<std::pair<iterator, bool>> emplace_back(Type data, Args... args) {
@@ -155,234 +227,197 @@ class Map {
   }
 
  private:
-  size_type MapSize{};
-  size_type MapMaxSize{};
-  std::shared_ptr<value_type[]> Store{new value_type[0]};
-  iterator EndIterator;
-  iterator BeginIterator;
-
-  void IncreaseStoreAllocation(const Map& old);
-
-  void DecreaseStoreAllocation(const Map& old);
-
-  void CheckEmptyToIncreaseIterator();
+  tree_type Store;
+  index_type Index;
+  bool Frozen{false};
 
-  void IncreaseSizeForInsert();
+  node_type* FindNode(const key_type& key) {
+    return Frozen ? Index.Find(key) : Store.Find(key);
+  }
 
-  bool InsertToEmptyCase(const value_type& value);
+  template <class Iterator>
+  static bool IsSortedByKey(Iterator first, Iterator last) {
+    return std::is_sorted(first, last, [](const auto& left, const auto& right) {
+      return left.first < right.first;
+    });
+  }
 
-  void StoreReset(std::shared_ptr<value_type[]> newStore);
+  template <class Iterator>
+  void InsertBatch(Iterator first, Iterator last, size_type count);
 };
 
-template <typename Key, typename T>
-void Map<Key, T>::StoreReset(std::shared_ptr<value_type[]> newStore) {
-  Store = std::move(newStore);
-  EndIterator.SetIterator(Store);
-  BeginIterator.SetIterator(Store);
+template <typename Key, typename T, typename Allocator>
+template <class ForwardIt>
+  requires std::forward_iterator<ForwardIt>
+Map<Key, T, Allocator> Map<Key, T, Allocator>::from_sorted(
+    ForwardIt first, ForwardIt last, const allocator_type& alloc) {
+  if (!IsSortedByKey(first, last)) {
+    throw std::invalid_argument("Keys are not sorted");
+  }
+  Map map(alloc);
+  map.Store.InsertSorted(first, last);
+  return map;
 }
 
-template <typename Key, typename T>
-bool Map<Key, T>::InsertToEmptyCase(const value_type& value) {
-  bool inserted{false};
-  if (empty()) {
-    MapSize += 1;
-    if (MapSize >= MapMaxSize) {
-      MapMaxSize += 1;
+template <typename Key, typename T, typename Allocator>
+template <class InputIt>
+  requires std::input_iterator<InputIt>
+void Map<Key, T, Allocator>::insert(InputIt first, InputIt last) {
+  if constexpr (std::forward_iterator<InputIt>) {
+    if (IsSortedByKey(first, last)) {
+      InsertBatch(first, last, std::distance(first, last));
+      return;
     }
-    IncreaseStoreAllocation(*this);
-    Store[0] = value;
-    inserted = true;
   }
-  return inserted;
+  Vector<value_type, GrowthDouble, allocator_type> batch(get_allocator());
+  for (; first != last; ++first) {
+    batch.emplace_back(*first);
+  }
+  std::stable_sort(batch.begin(), batch.end(),
+                   [](const value_type& left, const value_type& right) {
+                     return left.first < right.first;
+                   });
+  InsertBatch(batch.begin(), batch.end(), batch.size());
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::IncreaseSizeForInsert() {
-  MapSize += 1;
-  if (MapSize >= MapMaxSize) {
-    MapMaxSize += 1;
+//  a batch much smaller than the tree is cheaper to insert value by value
+//  than to merge with every node
+
+template <typename Key, typename T, typename Allocator>
+template <class Iterator>
+void Map<Key, T, Allocator>::InsertBatch(Iterator first, Iterator last,
+                                         size_type count) {
+  if (count * std::bit_width(Store.Size()) < Store.Size()) {
+    for (; first != last; ++first) {
+      insert(*first);
+    }
+    return;
   }
+  Thaw();
+  Store.InsertSorted(first, last);
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::DecreaseStoreAllocation(const Map& old) {
-  std::shared_ptr<value_type[]> store{new value_type[MapMaxSize]{}};
-  for (size_t i{0}; i < MapSize; i++) {
-    store[i] = old.Store[i];
-  }
-  Store = std::move(store);
+template <typename Key, typename T, typename Allocator>
+void Map<Key, T, Allocator>::merge(Map& other) {
+  Thaw();
+  other.Thaw();
+  Store.Merge(other.Store);
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::IncreaseStoreAllocation(const Map& old) {
-  std::shared_ptr<value_type[]> store{new value_type[MapMaxSize]{}};
-  for (size_t i{0}; i < MapSize; i++) {
-    store[i] = old.Store[i];
-  }
-  Store = std::move(store);
-  BeginIterator.SetIterator(Store);
-  EndIterator.SetIterator(Store);
+template <typename Key, typename T, typename Allocator>
+void Map<Key, T, Allocator>::swap(Map& other) {
+  Store.Swap(other.Store);
+  Index.Swap(other.Index);
+  std::swap(Frozen, other.Frozen);
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::merge(Map& other) {
-  MapIterator left(other.begin()), right(other.end());
-  while (left <= right) {
-    insert(*left);
-    ++left;
-  }
-  other.clear();
+template <typename Key, typename T, typename Allocator>
+void Map<Key, T, Allocator>::erase(iterator position) {
+  Thaw();
+  Store.Erase(position.GetNode());
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::swap(Map& other) {
-  Store.swap(other.Store);
-  std::swap(MapSize, other.MapSize);
-  std::swap(MapMaxSize, other.MapMaxSize);
-  BeginIterator.swap(other.BeginIterator);
-  EndIterator.swap(other.EndIterator);
+template <typename Key, typename T, typename Allocator>
+void Map<Key, T, Allocator>::clear() {
+  Thaw();
+  Store.Clear();
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::erase(iterator position) {
-  *position = std::make_pair(0, 0);
-  --EndIterator;
-  for (size_t i{0}, j{0}; i < MapSize; i++, j++) {
-    if (i == position.GetPosition()) {
-      j++;
-    }
-    Store[i] = Store[j];
-  }
-  MapSize -= 1;
+template <typename Key, typename T, typename Allocator>
+void Map<Key, T, Allocator>::operator=(Map&& other) noexcept(
+    move_assignment_steals_v<Allocator>) {
+  Thaw();
+  other.Thaw();
+  Store = std::move(other.Store);
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::clear() {
-  while (MapSize != 0) {
-    *EndIterator = std::make_pair(0, 0);
-    ;
-    --EndIterator;
-    MapSize--;
+template <typename Key, typename T, typename Allocator>
+typename Map<Key, T, Allocator>::isInserted
+Map<Key, T, Allocator>::insert(const value_type& value) {
+  auto inserted = Store.InsertUnique(value);
+  if (inserted.second) {
+    Thaw();
   }
-  Store.reset(new value_type[0]{});
-  MapMaxSize = 0;
-  EndIterator.SetIterator(Store);
-  BeginIterator.SetIterator(Store);
+  return std::make_pair(iterator(inserted.first, &Store), inserted.second);
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::operator=(Map&& other) {
-  MapSize = other.MapSize;
-  MapMaxSize = other.MapMaxSize;
-  Store.reset(new value_type[MapMaxSize]{});
-  for (int i{0}; i < MapSize; i++) {
-    Store[i] = other.Store[i];
-  }
-  BeginIterator.SetIterator(Store);
-  BeginIterator.copy(other.BeginIterator);
-  EndIterator.SetIterator(Store);
-  EndIterator.copy(other.EndIterator);
+template <typename Key, typename T, typename Allocator>
+typename Map<Key, T, Allocator>::isInserted
+Map<Key, T, Allocator>::insert(const Key& key, const T& obj) {
+  isInserted result = insert(std::make_pair(key, obj));
+  return result;
 }
 
-template <typename Key, typename T>
-void Map<Key, T>::CheckEmptyToIncreaseIterator() {
-  if (!empty()) {
-    ++EndIterator;
+template <typename Key, typename T, typename Allocator>
+typename Map<Key, T, Allocator>::isInserted
+Map<Key, T, Allocator>::insert_or_assign(const value_type& value) {
+  isInserted result = insert(value);
+  if (!result.second) {
+    (*result.first).second = value.second;
+    result.second = true;
   }
+  return result;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::isInserted Map<Key, T>::insert(const value_type& value) {
-  iterator positionIterator;
-  bool inserted = InsertToEmptyCase(value);
-  positionIterator.SetIterator(Store);
-  if (!inserted) {
-    inserted = contains(value.first);
+//  the in-order walk hands the nodes to the index already sorted
+
+template <typename Key, typename T, typename Allocator>
+void Map<Key, T, Allocator>::Freeze() {
+  if (Frozen) {
+    return;
   }
-  if (!inserted) {
-    size_type insertedPosition{};
-    IncreaseSizeForInsert();
-    std::shared_ptr<value_type[]> newStore{new value_type[MapMaxSize]};
-    for (size_type i{0}, j{0}; i < MapSize - 1; i++, j++) {
-      if (!inserted && value.first < Store[i].first) {
-        newStore[j] = value;
-        inserted = true;
-        ++EndIterator;
-        insertedPosition = j;
-        j++;
-      }
-      newStore[j] = Store[i];
-    }
-    if (!inserted) {
-      newStore[MapSize - 1] = value;
-      insertedPosition += 1;
-      ++EndIterator;
-      inserted = true;
-    }
-    StoreReset(newStore);
-    positionIterator.SetIterator(Store);
-    positionIterator.Advance(insertedPosition);
+  Vector<node_type*> sorted(Store.Size());
+  for (node_type* node = Store.First(); node != nullptr;
+       node = tree_type::Next(node)) {
+    sorted.push_back(node);
   }
-  isInserted result = std::make_pair(positionIterator, inserted);
-  return result;
+  Index.Build(sorted.data(), sorted.size(),
+              [](node_type* node) -> const key_type& {
+                return node->_value.first;
+              });
+  Frozen = true;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::isInserted Map<Key, T>::insert(const Key& key,
-                                                     const T& obj) {
-  isInserted result = insert(std::make_pair(key, obj));
-  return result;
+template <typename Key, typename T, typename Allocator>
+typename Map<Key, T, Allocator>::isFound
+Map<Key, T, Allocator>::FindPosition(const key_type& key) {
+  node_type* node = FindNode(key);
+  return std::make_pair(iterator(node, &Store), node != nullptr);
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::isInserted Map<Key, T>::insert_or_assign(
-    const value_type& value) {
-  isInserted result;
-  isFound found = FindPosition(value.first);
-  if (found.second) {
-    Store[found.first].second = value.second;
-    iterator positionIterator;
-    positionIterator.SetIterator(Store);
-    positionIterator.Advance(found.first);
-    result = std::make_pair(positionIterator, true);
-  } else {
-    result = insert(value);
+template <typename Key, typename T, typename Allocator>
+typename Map<Key, T, Allocator>::mapped_type&
+Map<Key, T, Allocator>::at(const key_type& key) {
+  node_type* node = FindNode(key);
+  if (node == nullptr) {
+    throw std::out_of_range("Не туда воююешь");
   }
-  return result;
+  return node->_value.second;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::isFound Map<Key, T>::FindPosition(const key_type& key) {
-  bool found{false};
-  int left{}, right = EndIterator.GetPosition(), middle{0};
-  while (left <= right && !found) {
-    middle = left + (right - left) / 2;
-    if (Store[middle].first == key) {
-      found = true;
-    } else if (Store[middle].first < key) {
-      left = middle + 1;
-    } else {
-      right = middle - 1;
-    }
+template <typename Key, typename T, typename Allocator>
+typename Map<Key, T, Allocator>::mapped_type&
+Map<Key, T, Allocator>::operator[](const key_type& key) {
+  node_type* node = FindNode(key);
+  if (node == nullptr) {
+    Thaw();
+    node = Store.InsertUnique(std::make_pair(key, mapped_type{})).first;
   }
-  return std::make_pair(middle, found);
+  return node->_value.second;
 }
 
-template <typename Key, typename T>
-typename Map<Key, T>::mapped_type& Map<Key, T>::at(const key_type& key) {
-  isFound result = FindPosition(key);
-  if (!result.second) {
-    throw std::out_of_range("Не туда воююешь");
-  }
-  return Store[result.first].second;
-}
+// the tree and the index own only heap memory
+template <typename Key, typename T, typename Allocator>
+struct is_trivially_relocatable<Map<Key, T, Allocator>>
+    : is_trivially_relocatable<Allocator> {};
+
+namespace pmr {
 
 template <typename Key, typename T>
-typename Map<Key, T>::mapped_type& Map<Key, T>::operator[](
-    const key_type& key) {
-  isFound result = FindPosition(key);
-  return Store[result.first].second;
-}
+using Map =
+    s21::Map<Key, T, std::pmr::polymorphic_allocator<std::pair<Key, T>>>;
+
+}  // namespace pmr
 
 }  // namespace s21
 
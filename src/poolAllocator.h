@@ -0,0 +1,185 @@
+#ifndef CONTAINERS_CPP_SRC_POOLALLOCATOR_H_
+#define CONTAINERS_CPP_SRC_POOLALLOCATOR_H_
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace s21 {
+
+//  Slab pool for small fixed-size blocks such as list nodes. Blocks are
+//  carved one after another out of big chunks, so nodes allocated together
+//  sit together in memory; a freed block goes to the free list of its size
+//  class and is handed out again first. release() returns every chunk at
+//  once without visiting the blocks
+
+class NodePool {
+ public:
+  explicit NodePool(size_t blocksPerChunk = 256)
+      : BlocksPerChunk(blocksPerChunk) {}
+
+  NodePool(const NodePool &other) = delete;
+
+  NodePool &operator=(const NodePool &other) = delete;
+
+  ~NodePool() { release(); }
+
+  void *allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+  void deallocate(void *block, size_t bytes,
+                  size_t alignment = alignof(std::max_align_t));
+
+  void release();
+
+  size_t chunks() const { return ChunkCount; }
+
+ private:
+  static constexpr size_t Granularity{alignof(std::max_align_t)};
+  static constexpr size_t MaxBlockSize{256};
+  static constexpr size_t ClassCount{MaxBlockSize / Granularity};
+
+  struct FreeBlock {
+    FreeBlock *Next;
+  };
+
+  struct alignas(std::max_align_t) Chunk {
+    Chunk *Next;
+  };
+
+  struct SizeClass {
+    FreeBlock *Free{nullptr};
+    char *Cursor{nullptr};
+    char *Limit{nullptr};
+  };
+
+  size_t BlocksPerChunk;
+  size_t ChunkCount{0};
+  Chunk *Chunks{nullptr};
+  SizeClass Classes[ClassCount];
+
+  static bool Pooled(size_t bytes, size_t alignment) {
+    return bytes <= MaxBlockSize && alignment <= Granularity;
+  }
+
+  static size_t ClassIndex(size_t bytes) {
+    return bytes == 0 ? 0 : (bytes - 1) / Granularity;
+  }
+};
+
+inline void *NodePool::allocate(size_t bytes, size_t alignment) {
+  if (!Pooled(bytes, alignment)) {
+    return ::operator new(bytes, std::align_val_t(alignment));
+  }
+  size_t index{ClassIndex(bytes)};
+  size_t blockSize{(index + 1) * Granularity};
+  SizeClass &sizeClass = Classes[index];
+  void *block;
+  if (sizeClass.Free != nullptr) {
+    block = sizeClass.Free;
+    sizeClass.Free = sizeClass.Free->Next;
+  } else {
+    if (sizeClass.Cursor == sizeClass.Limit) {
+      size_t chunkBytes{sizeof(Chunk) + blockSize * BlocksPerChunk};
+      Chunk *chunk = static_cast<Chunk *>(::operator new(chunkBytes));
+      chunk->Next = Chunks;
+      Chunks = chunk;
+      ChunkCount += 1;
+      sizeClass.Cursor = reinterpret_cast<char *>(chunk + 1);
+      sizeClass.Limit = sizeClass.Cursor + blockSize * BlocksPerChunk;
+    }
+    block = sizeClass.Cursor;
+    sizeClass.Cursor += blockSize;
+  }
+  return block;
+}
+
+inline void NodePool::deallocate(void *block, size_t bytes, size_t alignment) {
+  if (!Pooled(bytes, alignment)) {
+    ::operator delete(block, std::align_val_t(alignment));
+  } else {
+    SizeClass &sizeClass = Classes[ClassIndex(bytes)];
+    FreeBlock *freed = static_cast<FreeBlock *>(block);
+    freed->Next = sizeClass.Free;
+    sizeClass.Free = freed;
+  }
+}
+
+inline void NodePool::release() {
+  while (Chunks != nullptr) {
+    Chunk *next = Chunks->Next;
+    ::operator delete(Chunks);
+    Chunks = next;
+  }
+  ChunkCount = 0;
+  for (SizeClass &sizeClass : Classes) {
+    sizeClass = SizeClass{};
+  }
+}
+
+//  Standard allocator over a NodePool. A default constructed allocator
+//  creates its own pool, copies and rebinds share it, and a container copy
+//  gets a fresh one, so every container owns a private pool by default
+
+template <typename T>
+class PoolAllocator {
+ public:
+  typedef T value_type;
+  typedef std::false_type propagate_on_container_copy_assignment;
+  typedef std::true_type propagate_on_container_move_assignment;
+  typedef std::true_type propagate_on_container_swap;
+  typedef std::false_type is_always_equal;
+
+  PoolAllocator() : Pool(std::make_shared<NodePool>()) {}
+
+  explicit PoolAllocator(std::shared_ptr<NodePool> pool)
+      : Pool(std::move(pool)) {}
+
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U> &other) : Pool(other.Pool) {}
+
+  T *allocate(size_t count) {
+    return static_cast<T *>(Pool->allocate(count * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T *block, size_t count) {
+    Pool->deallocate(block, count * sizeof(T), alignof(T));
+  }
+
+  PoolAllocator select_on_container_copy_construction() const {
+    return PoolAllocator();
+  }
+
+  //  frees every block of the pool unless another allocator still shares
+  //  it; returns whether the memory was released
+
+  bool release() {
+    bool owner{Pool.use_count() == 1};
+    if (owner) {
+      Pool->release();
+    }
+    return owner;
+  }
+
+  size_t chunks() const { return Pool->chunks(); }
+
+  template <typename U>
+  bool operator==(const PoolAllocator<U> &other) const {
+    return Pool == other.Pool;
+  }
+
+  template <typename U>
+  bool operator!=(const PoolAllocator<U> &other) const {
+    return Pool != other.Pool;
+  }
+
+ private:
+  template <typename U>
+  friend class PoolAllocator;
+
+  std::shared_ptr<NodePool> Pool;
+};
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_SRC_POOLALLOCATOR_H_
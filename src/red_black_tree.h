@@ -0,0 +1,635 @@
+#ifndef CONTAINERS_CPP_SRC_RED_BLACK_TREE_H_
+#define CONTAINERS_CPP_SRC_RED_BLACK_TREE_H_
+
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "relocate.h"
+
+namespace s21 {
+
+// Red-black tree of std::pair<Key, T> ordered by pair.first with unique keys.
+// Every node is linked to its parent, so iteration needs no extra stack and
+// insert/erase rebalance in O(log N) without moving stored values.
+// Nodes come from Allocator rebound to Node.
+template <class Key, class T,
+          class Allocator = std::allocator<std::pair<Key, T>>>
+class RedBlackTree {
+ public:
+  typedef Key key_type;
+  typedef std::pair<Key, T> value_type;
+  typedef size_t size_type;
+  typedef Allocator allocator_type;
+
+  struct Node {
+    value_type _value;
+    Node* _left;
+    Node* _right;
+    Node* _parent;
+    bool _red;
+  };
+
+  RedBlackTree() {}
+
+  explicit RedBlackTree(const allocator_type& alloc) : _alloc(alloc) {}
+
+  RedBlackTree(const RedBlackTree& other)
+      : _alloc(node_traits::select_on_container_copy_construction(
+            other._alloc)) {
+    _root = _CopyTree(other._root, nullptr);
+    _size = other._size;
+  }
+
+  RedBlackTree(RedBlackTree&& other) noexcept : _alloc(other._alloc) {
+    _SwapNodes(other);
+  }
+
+  ~RedBlackTree() { Clear(); }
+
+  RedBlackTree& operator=(const RedBlackTree& other);
+
+  RedBlackTree& operator=(RedBlackTree&& other) noexcept(
+      move_assignment_steals_v<Allocator>);
+
+  size_type Size() const { return _size; }
+
+  Node* Root() const { return _root; }
+
+  Node* First() const { return _root == nullptr ? nullptr : Minimum(_root); }
+
+  Node* Last() const { return _root == nullptr ? nullptr : Maximum(_root); }
+
+  Node* Find(const key_type& key) const;
+
+  // returns the node holding value.first and whether it was created
+  std::pair<Node*, bool> InsertUnique(const value_type& value);
+
+  // merges a batch of values ordered by non-decreasing key in O(N + M):
+  // the tree is unlinked into a sorted list, the batch is merged into it
+  // (keys already present and repeated keys of the batch are skipped) and
+  // a balanced tree is rebuilt from the list
+  template <class Iterator>
+  void InsertSorted(Iterator first, Iterator last);
+
+  // moves the nodes of other whose keys this tree lacks into this tree in
+  // one merge pass over both in-order lists, O(N + M); nodes with keys
+  // present here stay in other. Nodes are relinked, not copied, unless
+  // the allocators differ
+  void Merge(RedBlackTree& other);
+
+  void Erase(Node* node);
+
+  void Clear();
+
+  void Swap(RedBlackTree& other) {
+    if constexpr (node_traits::propagate_on_container_swap::value) {
+      std::swap(_alloc, other._alloc);
+    }
+    _SwapNodes(other);
+  }
+
+  allocator_type GetAllocator() const { return allocator_type(_alloc); }
+
+  static Node* Minimum(Node* node);
+
+  static Node* Maximum(Node* node);
+
+  // in-order successor, nullptr after the last node
+  static Node* Next(Node* node);
+
+  // in-order predecessor, nullptr before the first node
+  static Node* Prev(Node* node);
+
+ private:
+  typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Node>
+      node_allocator;
+  typedef std::allocator_traits<node_allocator> node_traits;
+
+  Node* _root = nullptr;
+  size_type _size = 0;
+  node_allocator _alloc;
+
+  Node* _CreateNode(const value_type& value, Node* parent, bool red);
+  void _DestroyNode(Node* node);
+  void _SwapNodes(RedBlackTree& other) {
+    std::swap(_root, other._root);
+    std::swap(_size, other._size);
+  }
+
+  void _RotateLeft(Node* node);
+  void _RotateRight(Node* node);
+  void _InsertFixup(Node* node);
+  void _EraseFixup(Node* node, Node* parent);
+  void _Transplant(Node* from, Node* to);
+  void _DeleteAllTree(Node* tree);
+  Node* _CopyTree(Node* tree, Node* parent);
+  Node* _Unlink();
+  void _Relink(Node* list, size_type count);
+  Node* _BuildBalanced(Node*& list, size_type count, size_type depth,
+                       size_type redDepth, Node* parent);
+};
+
+}  // namespace s21
+
+template <class Key, class T, class Allocator>
+s21::RedBlackTree<Key, T, Allocator>&
+s21::RedBlackTree<Key, T, Allocator>::operator=(const RedBlackTree& other) {
+  if (this != &other) {
+    Clear();
+    if constexpr (node_traits::propagate_on_container_copy_assignment::value) {
+      _alloc = other._alloc;
+    }
+    _root = _CopyTree(other._root, nullptr);
+    _size = other._size;
+  }
+  return *this;
+}
+
+// nodes can only change owners when both trees free them the same way,
+// otherwise they are copied into this tree's allocator
+template <class Key, class T, class Allocator>
+s21::RedBlackTree<Key, T, Allocator>&
+s21::RedBlackTree<Key, T, Allocator>::operator=(RedBlackTree&& other) noexcept(
+    move_assignment_steals_v<Allocator>) {
+  if (this != &other) {
+    Clear();
+    if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+      _alloc = other._alloc;
+      _SwapNodes(other);
+    } else {
+      if (_alloc == other._alloc) {
+        _SwapNodes(other);
+      } else {
+        _root = _CopyTree(other._root, nullptr);
+        _size = other._size;
+        other.Clear();
+      }
+    }
+  }
+  return *this;
+}
+
+template <class Key, class T, class Allocator>
+typename s21::RedBlackTree<Key, T, Allocator>::Node*
+s21::RedBlackTree<Key, T, Allocator>::Find(const key_type& key) const {
+  Node* tree = _root;
+  while (tree != nullptr && !(tree->_value.first == key)) {
+    tree = key < tree->_value.first ? tree->_left : tree->_right;
+  }
+  return tree;
+}
+
+template <class Key, class T, class Allocator>
+std::pair<typename s21::RedBlackTree<Key, T, Allocator>::Node*, bool>
+s21::RedBlackTree<Key, T, Allocator>::InsertUnique(const value_type& value) {
+  Node* parent = nullptr;
+  Node** link = &_root;
+  while (*link != nullptr) {
+    parent = *link;
+    if (value.first < parent->_value.first) {
+      link = &parent->_left;
+    } else if (parent->_value.first < value.first) {
+      link = &parent->_right;
+    } else {
+      return std::make_pair(parent, false);
+    }
+  }
+  Node* node = _CreateNode(value, parent, true);
+  *link = node;
+  _InsertFixup(node);
+  _size++;
+  return std::make_pair(node, true);
+}
+
+// if a copy of a value throws, the list merged so far is still sorted and
+// is rebuilt into a valid tree before the exception leaves
+template <class Key, class T, class Allocator>
+template <class Iterator>
+void s21::RedBlackTree<Key, T, Allocator>::InsertSorted(Iterator first,
+                                                       Iterator last) {
+  Node* existing = _Unlink();
+  Node* merged = nullptr;
+  Node** link = &merged;
+  Node* tail = nullptr;
+  size_type count = _size;
+  try {
+    while (first != last) {
+      const value_type& value = *first;
+      if (existing != nullptr && existing->_value.first < value.first) {
+        tail = existing;
+        existing = existing->_right;
+      } else if ((existing != nullptr &&
+                  !(value.first < existing->_value.first)) ||
+                 (tail != nullptr && !(tail->_value.first < value.first))) {
+        ++first;
+        continue;
+      } else {
+        tail = _CreateNode(value, nullptr, false);
+        count++;
+        ++first;
+      }
+      *link = tail;
+      link = &tail->_right;
+    }
+  } catch (...) {
+    *link = existing;
+    _Relink(merged, count);
+    throw;
+  }
+  *link = existing;
+  _Relink(merged, count);
+}
+
+template <class Key, class T, class Allocator>
+void s21::RedBlackTree<Key, T, Allocator>::Merge(RedBlackTree& other) {
+  if (this == &other) {
+    return;
+  }
+  Node* mine = _Unlink();
+  Node* theirs = other._Unlink();
+  Node* merged = nullptr;
+  Node** mergedLink = &merged;
+  Node* kept = nullptr;
+  Node** keptLink = &kept;
+  size_type count = _size;
+  size_type keptCount = 0;
+  try {
+    while (theirs != nullptr) {
+      Node* node;
+      if (mine != nullptr && mine->_value.first < theirs->_value.first) {
+        node = mine;
+        mine = mine->_right;
+      } else if (mine != nullptr &&
+                 !(theirs->_value.first < mine->_value.first)) {
+        *keptLink = theirs;
+        keptLink = &theirs->_right;
+        theirs = theirs->_right;
+        keptCount++;
+        continue;
+      } else if (_alloc == other._alloc) {
+        node = theirs;
+        theirs = theirs->_right;
+        count++;
+      } else {
+        node = _CreateNode(theirs->_value, nullptr, false);
+        Node* next = theirs->_right;
+        other._DestroyNode(theirs);
+        theirs = next;
+        count++;
+      }
+      *mergedLink = node;
+      mergedLink = &node->_right;
+    }
+  } catch (...) {
+    *mergedLink = mine;
+    *keptLink = theirs;
+    for (; theirs != nullptr; theirs = theirs->_right) {
+      keptCount++;
+    }
+    _Relink(merged, count);
+    other._Relink(kept, keptCount);
+    throw;
+  }
+  *mergedLink = mine;
+  *keptLink = nullptr;
+  _Relink(merged, count);
+  other._Relink(kept, keptCount);
+}
+
+template <class Key, class T, class Allocator>
+void s21::RedBlackTree<Key, T, Allocator>::Erase(Node* node) {
+  Node* moved = node;
+  bool movedRed = moved->_red;
+  Node* child;
+  Node* childParent;
+  if (node->_left == nullptr) {
+    child = node->_right;
+    childParent = node->_parent;
+    _Transplant(node, node->_right);
+  } else if (node->_right == nullptr) {
+    child = node->_left;
+    childParent = node->_parent;
+    _Transplant(node, node->_left);
+  } else {
+    moved = Minimum(node->_right);
+    movedRed = moved->_red;
+    child = moved->_right;
+    if (moved->_parent == node) {
+      childParent = moved;
+    } else {
+      childParent = moved->_parent;
+      _Transplant(moved, moved->_right);
+      moved->_right = node->_right;
+      moved->_right->_parent = moved;
+    }
+    _Transplant(node, moved);
+    moved->_left = node->_left;
+    moved->_left->_parent = moved;
+    moved->_red = node->_red;
+  }
+  if (!movedRed) {
+    _EraseFixup(child, childParent);
+  }
+  _DestroyNode(node);
+  _size--;
+}
+
+// the in-order list is chained through _right; it is built from the last
+// node backwards, because Prev never reads the _right of a larger node
+template <class Key, class T, class Allocator>
+typename s21::RedBlackTree<Key, T, Allocator>::Node*
+s21::RedBlackTree<Key, T, Allocator>::_Unlink() {
+  Node* list = nullptr;
+  for (Node* node = Last(); node != nullptr;) {
+    Node* prev = Prev(node);
+    node->_right = list;
+    list = node;
+    node = prev;
+  }
+  _root = nullptr;
+  return list;
+}
+
+// all levels above the deepest one are full, so coloring only the nodes
+// of an incomplete deepest level red balances the black heights
+template <class Key, class T, class Allocator>
+void s21::RedBlackTree<Key, T, Allocator>::_Relink(Node* list,
+                                                  size_type count) {
+  size_type redDepth = std::bit_width(count + 1) - 1;
+  _root = _BuildBalanced(list, count, 0, redDepth, nullptr);
+  _size = count;
+}
+
+template <class Key, class T, class Allocator>
+typename s21::RedBlackTree<Key, T, Allocator>::Node*
+s21::RedBlackTree<Key, T, Allocator>::_BuildBalanced(Node*& list,
+                                                    size_type count,
+                                                    size_type depth,
+                                                    size_type redDepth,
+                                                    Node* parent) {
+  if (count == 0) {
+    return nullptr;
+  }
+  size_type leftCount = (count - 1) / 2;
+  Node* left = _BuildBalanced(list, leftCount, depth + 1, redDepth, nullptr);
+  Node* node = list;
+  list = list->_right;
+  node->_parent = parent;
+  node->_left = left;
+  node->_red = depth == redDepth;
+  if (left != nullptr) {
+    left->_parent = node;
+  }
+  node->_right = _BuildBalanced(list, count - 1 - leftCount, depth + 1,
+                                redDepth, node);
+  return node;
+}
+
+template <class Key, class T, class Allocator>
+void s21::RedBlackTree<Key, T, Allocator>::Clear() {
+  _DeleteAllTree(_root);
+  _root = nullptr;
+  _size = 0;
+}
+
+template <class Key, class T, class Allocator>
+typename s21::RedBlackTree<Key, T, Allocator>::Node*
+s21::RedBlackTree<Key, T, Allocator>::Minimum(Node* node) {
+  while (node->_left != nullptr) {
+    node = node->_left;
+  }
+  return node;
+}
+
+template <class Key, class T, class Allocator>
+typename s21::RedBlackTree<Key, T, Allocator>::Node*
+s21::RedBlackTree<Key, T, Allocator>::Maximum(Node* node) {
+  while (node->_right != nullptr) {
+    node = node->_right;
+  }
+  return node;
+}
+
+template <class Key, class T, class Allocator>
+typename s21::RedBlackTree<Key, T, Allocator>::Node*
+s21::RedBlackTree<Key, T, Allocator>::Next(Node* node) {
+  if (node->_right != nullptr) {
+    return Minimum(node->_right);
+  }
+  Node* parent = node->_parent;
+  while (parent != nullptr && node == parent->_right) {
+    node = parent;
+    parent = parent->_parent;
+  }
+  return parent;
+}
+
+template <class Key, class T, class Allocator>
+typename s21::RedBlackTree<Key, T, Allocator>::Node*
+s21::RedBlackTree<Key, T, Allocator>::Prev(Node* node) {
+  if (node->_left != nullptr) {
+    return Maximum(node->_left);
+  }
+  Node* parent = node->_parent;
+  while (parent != nullptr && node == parent->_left) {
+    node = parent;
+    parent = parent->_parent;
+  }
+  return parent;
+}
+
+template <class Key, class T, class Allocator>
+void s21::RedBlackTree<Key, T, Allocator>::_RotateLeft(Node* node) {
+  Node* pivot = node->_right;
+  node->_right = pivot->_left;
+  if (pivot->_left != nullptr) {
+    pivot->_left->_parent = node;
+  }
+  _Transplant(node, pivot);
+  pivot->_left = node;
+  node->_parent = pivot;
+}
+
+template <class Key, class T, class Allocator>
+void s21::RedBlackTree<Key, T, Allocator>::_RotateRight(Node* node) {
+  Node* pivot = node->_left;
+  node->_left = pivot->_right;
+  if (pivot->_right != nullptr) {
+    pivot->_right->_parent = node;
+  }
+  _Transplant(node, pivot);
+  pivot->_right = node;
+  node->_parent = pivot;
+}
+
+template <class Key, class T, class Allocator>
+void s21::RedBlackTree<Key, T, Allocator>::_InsertFixup(Node* node) {
+  while (node != _root && node->_parent->_red) {
+    Node* parent = node->_parent;
+    Node* grand = parent->_parent;
+    if (parent == grand->_left) {
+      Node* uncle = grand->_right;
+      if (uncle != nullptr && uncle->_red) {
+        parent->_red = uncle->_red = false;
+        grand->_red = true;
+        node = grand;
+      } else {
+        if (node == parent->_right) {
+          node = parent;
+          _RotateLeft(node);
+          parent = node->_parent;
+        }
+        parent->_red = false;
+        grand->_red = true;
+        _RotateRight(grand);
+      }
+    } else {
+      Node* uncle = grand->_left;
+      if (uncle != nullptr && uncle->_red) {
+        parent->_red = uncle->_red = false;
+        grand->_red = true;
+        node = grand;
+      } else {
+        if (node == parent->_left) {
+          node = parent;
+          _RotateRight(node);
+          parent = node->_parent;
+        }
+        parent->_red = false;
+        grand->_red = true;
+        _RotateLeft(grand);
+      }
+    }
+  }
+  _root->_red = false;
+}
+
+// node replaced the erased black node and may be nullptr, so its parent is
+// tracked separately
+template <class Key, class T, class Allocator>
+void s21::RedBlackTree<Key, T, Allocator>::_EraseFixup(Node* node,
+                                                       Node* parent) {
+  while (node != _root && (node == nullptr || !node->_red)) {
+    if (node == parent->_left) {
+      Node* sibling = parent->_right;
+      if (sibling->_red) {
+        sibling->_red = false;
+        parent->_red = true;
+        _RotateLeft(parent);
+        sibling = parent->_right;
+      }
+      bool leftBlack = sibling->_left == nullptr || !sibling->_left->_red;
+      bool rightBlack = sibling->_right == nullptr || !sibling->_right->_red;
+      if (leftBlack && rightBlack) {
+        sibling->_red = true;
+        node = parent;
+        parent = node->_parent;
+      } else {
+        if (rightBlack) {
+          sibling->_left->_red = false;
+          sibling->_red = true;
+          _RotateRight(sibling);
+          sibling = parent->_right;
+        }
+        sibling->_red = parent->_red;
+        parent->_red = false;
+        if (sibling->_right != nullptr) sibling->_right->_red = false;
+        _RotateLeft(parent);
+        node = _root;
+      }
+    } else {
+      Node* sibling = parent->_left;
+      if (sibling->_red) {
+        sibling->_red = false;
+        parent->_red = true;
+        _RotateRight(parent);
+        sibling = parent->_left;
+      }
+      bool leftBlack = sibling->_left == nullptr || !sibling->_left->_red;
+      bool rightBlack = sibling->_right == nullptr || !sibling->_right->_red;
+      if (leftBlack && rightBlack) {
+        sibling->_red = true;
+        node = parent;
+        parent = node->_parent;
+      } else {
+        if (leftBlack) {
+          sibling->_right->_red = false;
+          sibling->_red = true;
+          _RotateLeft(sibling);
+          sibling = parent->_left;
+        }
+        sibling->_red = parent->_red;
+        parent->_red = false;
+        if (sibling->_left != nullptr) sibling->_left->_red = false;
+        _RotateRight(parent);
+        node = _root;
+      }
+    }
+  }
+  if (node != nullptr) node->_red = false;
+}
+
+template <class Key, class T, class Allocator>
+void s21::RedBlackTree<Key, T, Allocator>::_Transplant(Node* from, Node* to) {
+  if (from->_parent == nullptr) {
+    _root = to;
+  } else if (from == from->_parent->_left) {
+    from->_parent->_left = to;
+  } else {
+    from->_parent->_right = to;
+  }
+  if (to != nullptr) to->_parent = from->_parent;
+}
+
+template <class Key, class T, class Allocator>
+void s21::RedBlackTree<Key, T, Allocator>::_DeleteAllTree(Node* tree) {
+  while (tree != nullptr) {
+    _DeleteAllTree(tree->_right);
+    Node* left = tree->_left;
+    _DestroyNode(tree);
+    tree = left;
+  }
+}
+
+// a copy that throws halfway frees the nodes it already built
+template <class Key, class T, class Allocator>
+typename s21::RedBlackTree<Key, T, Allocator>::Node*
+s21::RedBlackTree<Key, T, Allocator>::_CopyTree(Node* tree,
+                                                Node* parent) {
+  Node* copy = nullptr;
+  if (tree != nullptr) {
+    copy = _CreateNode(tree->_value, parent, tree->_red);
+    try {
+      copy->_left = _CopyTree(tree->_left, copy);
+      copy->_right = _CopyTree(tree->_right, copy);
+    } catch (...) {
+      _DeleteAllTree(copy);
+      throw;
+    }
+  }
+  return copy;
+}
+
+template <class Key, class T, class Allocator>
+typename s21::RedBlackTree<Key, T, Allocator>::Node*
+s21::RedBlackTree<Key, T, Allocator>::_CreateNode(const value_type& value,
+                                                  Node* parent, bool red) {
+  Node* node = node_traits::allocate(_alloc, 1);
+  try {
+    node_traits::construct(_alloc, node, value, nullptr, nullptr, parent, red);
+  } catch (...) {
+    node_traits::deallocate(_alloc, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <class Key, class T, class Allocator>
+void s21::RedBlackTree<Key, T, Allocator>::_DestroyNode(Node* node) {
+  node_traits::destroy(_alloc, node);
+  node_traits::deallocate(_alloc, node, 1);
+}
+
+#endif  // CONTAINERS_CPP_SRC_RED_BLACK_TREE_H_
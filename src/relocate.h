@@ -0,0 +1,186 @@
+#ifndef CONTAINERS_CPP_SRC_RELOCATE_H_
+#define CONTAINERS_CPP_SRC_RELOCATE_H_
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+//  Relocating an object means building it at a new address and destroying
+//  it at the old one. For a trivially relocatable type that is the same as
+//  copying its bytes, so whole ranges move with one memcpy/memmove. Every
+//  trivially copyable type qualifies; a user type that owns resources but
+//  does not point into itself (a unique_ptr wrapper, say) can opt in with
+//
+//    template <>
+//    struct s21::is_trivially_relocatable<MyType> : std::true_type {};
+//
+//  The byte copy bypasses Allocator::construct, so an allocator that
+//  injects itself into the elements (uses-allocator construction) only
+//  gets the fast path for types that do not take an allocator anyway.
+
+template <typename Type>
+struct is_trivially_relocatable : std::is_trivially_copyable<Type> {};
+
+//  std::allocator is empty but declares its own copy constructor
+
+template <typename Type>
+struct is_trivially_relocatable<std::allocator<Type>> : std::true_type {};
+
+//  a pair is relocatable when its members are, std::pair assigns through
+//  its own operator= and so is never trivially copyable
+
+template <typename First, typename Second>
+struct is_trivially_relocatable<std::pair<First, Second>>
+    : std::bool_constant<
+          is_trivially_relocatable<std::remove_const_t<First>>::value &&
+          is_trivially_relocatable<std::remove_const_t<Second>>::value> {};
+
+template <typename Type>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<Type>::value;
+
+//  A container move assignment takes over the memory of the other one when
+//  the allocator moves along with it or any two allocators are equal; then
+//  it neither allocates nor throws. With other allocators the elements are
+//  moved one by one
+
+template <typename Allocator>
+inline constexpr bool move_assignment_steals_v =
+    std::allocator_traits<
+        Allocator>::propagate_on_container_move_assignment::value ||
+    std::allocator_traits<Allocator>::is_always_equal::value;
+
+//  Relocates [first, last) into raw memory at dest, the ranges do not
+//  overlap. Elements are moved when that cannot throw and copied otherwise,
+//  so if a constructor throws the source is left as it was.
+
+template <typename Allocator, typename Type>
+void UninitializedRelocate(Allocator &alloc, Type *first, Type *last,
+                           Type *dest) {
+  typedef std::allocator_traits<Allocator> alloc_traits;
+  if constexpr (is_trivially_relocatable_v<Type>) {
+    if (first != last) {
+      std::memcpy(static_cast<void *>(dest), static_cast<void *>(first),
+                  (last - first) * sizeof(Type));
+    }
+  } else {
+    Type *built{dest};
+    try {
+      for (Type *from{first}; from != last; from++, built++) {
+        alloc_traits::construct(alloc, built, std::move_if_noexcept(*from));
+      }
+    } catch (...) {
+      for (Type *done{dest}; done != built; done++) {
+        alloc_traits::destroy(alloc, done);
+      }
+      throw;
+    }
+    for (Type *from{first}; from != last; from++) {
+      alloc_traits::destroy(alloc, from);
+    }
+  }
+}
+
+//  Moves [first, last) one slot to the right: *last is raw memory before
+//  the call and *first is raw memory after it
+
+template <typename Allocator, typename Type>
+void RelocateRight(Allocator &alloc, Type *first, Type *last) {
+  typedef std::allocator_traits<Allocator> alloc_traits;
+  if constexpr (is_trivially_relocatable_v<Type>) {
+    std::memmove(static_cast<void *>(first + 1), static_cast<void *>(first),
+                 (last - first) * sizeof(Type));
+  } else {
+    if (first != last) {
+      alloc_traits::construct(alloc, last, std::move(*(last - 1)));
+      std::move_backward(first, last - 1, last);
+      alloc_traits::destroy(alloc, first);
+    }
+  }
+}
+
+//  Moves [first + 1, last) one slot to the left: *first is raw memory
+//  before the call and *(last - 1) is raw memory after it
+
+template <typename Allocator, typename Type>
+void RelocateLeft(Allocator &alloc, Type *first, Type *last) {
+  typedef std::allocator_traits<Allocator> alloc_traits;
+  if constexpr (is_trivially_relocatable_v<Type>) {
+    std::memmove(static_cast<void *>(first), static_cast<void *>(first + 1),
+                 (last - first - 1) * sizeof(Type));
+  } else {
+    if (first + 1 != last) {
+      alloc_traits::construct(alloc, first, std::move(*(first + 1)));
+      std::move(first + 2, last, first + 1);
+      alloc_traits::destroy(alloc, last - 1);
+    }
+  }
+}
+
+//  The element operations Vector and SmallVector share: they only differ
+//  in where the store comes from
+
+template <typename Allocator, typename Type>
+void DestroyRange(Allocator &alloc, Type *first, Type *last) {
+  if constexpr (!std::is_trivially_destructible_v<Type>) {
+    for (; first != last; first++) {
+      std::allocator_traits<Allocator>::destroy(alloc, first);
+    }
+  }
+}
+
+//  copy-constructs [first, last) into raw memory at dest; if a copy throws,
+//  the ones already built are destroyed again
+
+template <typename Allocator, typename Type>
+void UninitializedCopy(Allocator &alloc, const Type *first, const Type *last,
+                       Type *dest) {
+  if constexpr (std::is_trivially_copyable_v<Type>) {
+    if (first != last) {
+      std::memcpy(static_cast<void *>(dest), static_cast<const void *>(first),
+                  (last - first) * sizeof(Type));
+    }
+  } else {
+    Type *built{dest};
+    try {
+      for (; first != last; first++, built++) {
+        std::allocator_traits<Allocator>::construct(alloc, built, *first);
+      }
+    } catch (...) {
+      DestroyRange(alloc, dest, built);
+      throw;
+    }
+  }
+}
+
+//  builds value at pos in front of the elements [pos, last), which move one
+//  slot to the right into the raw memory at last; if the construction
+//  throws they move back
+
+template <typename Allocator, typename Type>
+void RelocateInsert(Allocator &alloc, Type *pos, Type *last, Type &&value) {
+  RelocateRight(alloc, pos, last);
+  try {
+    std::allocator_traits<Allocator>::construct(alloc, pos, std::move(value));
+  } catch (...) {
+    RelocateLeft(alloc, pos, last + 1);
+    throw;
+  }
+}
+
+//  destroys the element at pos and closes the gap, *(last - 1) is raw
+//  memory after the call
+
+template <typename Allocator, typename Type>
+void RelocateErase(Allocator &alloc, Type *pos, Type *last) {
+  std::allocator_traits<Allocator>::destroy(alloc, pos);
+  RelocateLeft(alloc, pos, last);
+}
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_SRC_RELOCATE_H_
@@ -0,0 +1,271 @@
+#ifndef CONTAINERS_CPP_SRC_RINGBUFFER_H_
+#define CONTAINERS_CPP_SRC_RINGBUFFER_H_
+
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+#include "relocate.h"
+
+namespace s21 {
+
+//  RingBuffer keeps its elements in a circular buffer whose capacity is a
+//  power of two: Head is the index of the front element and an index wraps
+//  around with "& Mask" instead of a division, so push_back and pop_front
+//  never shift the store and the buffer is only reallocated (doubled) when
+//  it is full. Only the Count slots from Head on hold objects, the rest of
+//  the store is raw memory. It is the default store of s21::Queue
+
+template<typename Type, typename Allocator = std::allocator<Type>>
+class RingBuffer {
+ public:
+  typedef size_t size_type;
+  typedef Type value_type;
+  typedef Type &reference;
+  typedef const Type &const_reference;
+  typedef Allocator allocator_type;
+
+  RingBuffer() {}
+
+  explicit RingBuffer(const Allocator &alloc) : Alloc(alloc) {}
+
+  RingBuffer(std::initializer_list<value_type> const &items,
+             const Allocator &alloc = Allocator()) : Alloc(alloc) {
+    Reallocate(RoundUpCapacity(items.size()));
+    try {
+      for (auto iter{items.begin()}; iter != items.end(); iter++) {
+        push_back(*iter);
+      }
+    } catch (...) {
+      clear();
+      DeallocateStore();
+      throw;
+    }
+  }
+
+  //  a copy that throws frees what it has built, no destructor runs
+
+  RingBuffer(const RingBuffer &old)
+      : Alloc(alloc_traits::select_on_container_copy_construction(old.Alloc)) {
+    Reallocate(RoundUpCapacity(old.Count));
+    try {
+      for (size_type i{0}; i < old.Count; i++) {
+        push_back(old.Store[(old.Head + i) & old.Mask]);
+      }
+    } catch (...) {
+      clear();
+      DeallocateStore();
+      throw;
+    }
+  }
+
+  RingBuffer(RingBuffer &&old) noexcept : Alloc(old.Alloc) {SwapStore(old);}
+
+  ~RingBuffer() {
+    clear();
+    DeallocateStore();
+  }
+
+  void push_back(const Type &value) {emplace_back(value);}
+
+  void push_back(Type &&value) {emplace_back(std::move(value));}
+
+  template<class... Args>
+  reference emplace_back(Args&&... args) {
+    if (Count == Capacity) {
+      return EmplaceGrow(std::forward<Args>(args)...);
+    }
+    Type *Slot{Store + ((Head + Count) & Mask)};
+    alloc_traits::construct(Alloc, Slot, std::forward<Args>(args)...);
+    Count += 1;
+    return *Slot;
+  }
+
+  //  front, back and the pops expect a non-empty buffer, the adaptors
+  //  check it
+
+  void pop_front() {
+    alloc_traits::destroy(Alloc, Store + Head);
+    Head = (Head + 1) & Mask;
+    Count -= 1;
+  }
+
+  void pop_back() {
+    Count -= 1;
+    alloc_traits::destroy(Alloc, Store + ((Head + Count) & Mask));
+  }
+
+  reference front() {return Store[Head];}
+
+  reference back() {return Store[(Head + Count - 1) & Mask];}
+
+  reference operator[](size_type pos) {return Store[(Head + pos) & Mask];}
+
+  bool empty() {return Count == 0;}
+
+  size_type size() {return Count;}
+
+  size_type capacity() {return Capacity;}
+
+  void clear() {
+    while (Count != 0) {
+      pop_front();
+    }
+    Head = 0;
+  }
+
+  void swap(RingBuffer &other);
+
+  void operator=(RingBuffer &&old) noexcept(
+      move_assignment_steals_v<Allocator>);
+
+  allocator_type get_allocator() {return Alloc;}
+
+ private:
+  typedef std::allocator_traits<Allocator> alloc_traits;
+
+  static constexpr size_type MinCapacity{8};
+
+  Allocator Alloc;
+  Type *Store{nullptr};
+  size_type Head{0};
+  size_type Count{0};
+  size_type Capacity{0};
+  size_type Mask{0};
+
+  static size_type RoundUpCapacity(size_type NewSize) {
+    size_type NewCapacity{MinCapacity};
+    while (NewCapacity < NewSize) {
+      NewCapacity <<= 1;
+    }
+    return NewCapacity;
+  }
+
+  template<class... Args>
+  reference EmplaceGrow(Args&&... args);
+
+  void Reallocate(size_type NewCapacity);
+
+  void DeallocateStore() {
+    if (Store != nullptr) {
+      alloc_traits::deallocate(Alloc, Store, Capacity);
+      Store = nullptr;
+    }
+  }
+
+  void SwapStore(RingBuffer &other) {
+    std::swap(Store, other.Store);
+    std::swap(Head, other.Head);
+    std::swap(Count, other.Count);
+    std::swap(Capacity, other.Capacity);
+    std::swap(Mask, other.Mask);
+  }
+};
+
+template<typename Type, typename Allocator>
+void RingBuffer<Type, Allocator>::swap(RingBuffer &other) {
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    std::swap(Alloc, other.Alloc);
+  }
+  SwapStore(other);
+}
+
+//  the store can be taken over only when this allocator is able to free it,
+//  otherwise the elements are moved one by one into a store of our own
+
+template<typename Type, typename Allocator>
+void RingBuffer<Type, Allocator>::operator=(RingBuffer &&old) noexcept(
+    move_assignment_steals_v<Allocator>) {
+  if (this == &old) {
+    return;
+  }
+  if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+    RingBuffer moved(std::move(old));
+    SwapStore(moved);
+    std::swap(Alloc, moved.Alloc);
+  } else if (Alloc == old.Alloc) {
+    RingBuffer moved(std::move(old));
+    SwapStore(moved);
+  } else {
+    RingBuffer moved(Alloc);
+    moved.Reallocate(RoundUpCapacity(old.Count));
+    for (size_type i{0}; i < old.Count; i++) {
+      moved.push_back(std::move(old.Store[(old.Head + i) & old.Mask]));
+    }
+    SwapStore(moved);
+  }
+}
+
+//  the new element is built before the store is reallocated, so pushing a
+//  reference to an element of the buffer is safe
+
+template<typename Type, typename Allocator>
+template<class... Args>
+typename RingBuffer<Type, Allocator>::reference
+RingBuffer<Type, Allocator>::EmplaceGrow(Args&&... args) {
+  value_type Emplaced(std::forward<Args>(args)...);
+  Reallocate(Capacity == 0 ? MinCapacity : Capacity << 1);
+  Type *Slot{Store + Count};
+  alloc_traits::construct(Alloc, Slot, std::move(Emplaced));
+  Count += 1;
+  return *Slot;
+}
+
+//  unrolls the wrapped elements so the front lands at index 0 again: two
+//  byte copies for a trivially relocatable Type, element by element
+//  otherwise
+
+template<typename Type, typename Allocator>
+void RingBuffer<Type, Allocator>::Reallocate(size_type NewCapacity) {
+  Type *store{alloc_traits::allocate(Alloc, NewCapacity)};
+  size_type Tail{Capacity - Head < Count ? Capacity - Head : Count};
+  if constexpr (is_trivially_relocatable_v<Type>) {
+    if (Count != 0) {
+      std::memcpy(static_cast<void *>(store),
+                  static_cast<void *>(Store + Head), Tail * sizeof(Type));
+      std::memcpy(static_cast<void *>(store + Tail),
+                  static_cast<void *>(Store), (Count - Tail) * sizeof(Type));
+    }
+  } else {
+    size_type built{0};
+    try {
+      for (; built < Count; built++) {
+        alloc_traits::construct(
+            Alloc, store + built,
+            std::move_if_noexcept(Store[(Head + built) & Mask]));
+      }
+    } catch (...) {
+      for (size_type i{0}; i < built; i++) {
+        alloc_traits::destroy(Alloc, store + i);
+      }
+      alloc_traits::deallocate(Alloc, store, NewCapacity);
+      throw;
+    }
+    for (size_type i{0}; i < Count; i++) {
+      alloc_traits::destroy(Alloc, Store + ((Head + i) & Mask));
+    }
+  }
+  DeallocateStore();
+  Store = store;
+  Head = 0;
+  Capacity = NewCapacity;
+  Mask = NewCapacity - 1;
+}
+
+template<typename Type, typename Allocator>
+struct is_trivially_relocatable<RingBuffer<Type, Allocator>>
+    : is_trivially_relocatable<Allocator> {};
+
+namespace pmr {
+
+template<typename Type>
+using RingBuffer =
+    s21::RingBuffer<Type, std::pmr::polymorphic_allocator<Type>>;
+
+}  // namespace pmr
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_SRC_RINGBUFFER_H_
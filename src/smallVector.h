@@ -0,0 +1,386 @@
+#ifndef CONTAINERS_CPP_SRC_SMALLVECTOR_H_
+#define CONTAINERS_CPP_SRC_SMALLVECTOR_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "contiguousIterator.h"
+#include "relocate.h"
+#include "vector.h"
+
+namespace s21 {
+
+//  Vector with room for N elements inside the object itself: while size()
+//  stays within N nothing is allocated, past that the elements move to a
+//  store obtained from Allocator that grows by Growth, as in Vector.
+//  The interface is the one of Vector. Moving a SmallVector whose elements
+//  are inline relocates them one by one, so it is O(size()), not O(1)
+
+template<typename Type, size_t N, typename Growth = GrowthDouble,
+         typename Allocator = std::allocator<Type>>
+class SmallVector {
+  static_assert(N > 0, "SmallVector needs room for at least one element");
+
+ public:
+  typedef size_t size_type;
+  typedef Type value_type;
+  typedef Type &reference;
+  typedef const Type &const_reference;
+  typedef ContiguousIterator<Type> iterator;
+  typedef ContiguousIterator<const Type> const_iterator;
+  typedef Allocator allocator_type;
+
+  static constexpr size_type InlineCapacity{N};
+
+  //  SmallVector constructors
+
+  SmallVector() {}
+
+  explicit SmallVector(const Allocator &alloc) : Alloc(alloc) {}
+
+  SmallVector(const size_type NewSize, const Allocator &alloc = Allocator())
+      : Alloc(alloc) {
+    reserve(NewSize);
+  }
+
+  SmallVector(const SmallVector &other)
+      : Alloc(alloc_traits::select_on_container_copy_construction(other.Alloc)) {
+    reserve(other.VectorSize);
+    try {
+      UninitializedCopy(Alloc, other.Store, other.Store + other.VectorSize,
+                        Store);
+    } catch (...) {
+      DeallocateHeap();
+      throw;
+    }
+    VectorSize = other.VectorSize;
+  }
+
+  SmallVector(std::initializer_list<value_type> const &items,
+              const Allocator &alloc = Allocator())
+      : Alloc(alloc) {
+    reserve(items.size());
+    for (auto iter{items.begin()}; iter != items.end(); iter++) {
+      push_back(*iter);
+    }
+  }
+
+  SmallVector(SmallVector &&other) noexcept(NothrowRelocate)
+      : Alloc(other.Alloc) {TakeElements(other);}
+
+  ~SmallVector() {
+    DestroyRange(Alloc, Store, Store + VectorSize);
+    DeallocateHeap();
+  }
+
+  //  SmallVector methods
+
+  void push_back(const_reference value) {emplace_back(value);}
+
+  void push_back(value_type &&value) {emplace_back(std::move(value));}
+
+  void pop_back();
+
+  void shrink_to_fit();
+
+  void reserve(size_type NewSize);
+
+  void swap(SmallVector &other);
+
+  reference front();
+
+  reference back();
+
+  reference at(size_type pos);
+
+  iterator begin() {return iterator(Store);}
+
+  iterator end() {return iterator(Store + VectorSize);}
+
+  const_iterator begin() const {return const_iterator(Store);}
+
+  const_iterator end() const {return const_iterator(Store + VectorSize);}
+
+  reference operator[](size_type pos) {return Store[pos];}
+
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  void operator=(SmallVector &&other) noexcept(
+      NothrowRelocate && move_assignment_steals_v<Allocator>);
+
+  //  capacity methods
+
+  bool empty() {return VectorSize == 0;}
+
+  size_type size() {return VectorSize;}
+
+  size_type max_size() {return std::numeric_limits<size_type>::max() / sizeof(Type);}
+
+  size_type capacity() {return VectorMaxSize;}
+
+  //  true while the elements live in the object itself
+
+  bool IsInline() const {return Store == InlineStore();}
+
+  void clear();
+
+  void erase(const_iterator position);
+
+  Type *data() {return Store;}
+
+  allocator_type get_allocator() {return Alloc;}
+
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
+
+  template <class... Args>
+  reference emplace_back(Args&&... args);
+
+ private:
+  typedef std::allocator_traits<Allocator> alloc_traits;
+
+  //  inline elements move without throwing, the moves are then noexcept
+
+  static constexpr bool NothrowRelocate{
+      is_trivially_relocatable_v<Type> ||
+      std::is_nothrow_move_constructible_v<Type>};
+
+  Allocator Alloc;
+  Type *Store{InlineStore()};
+  size_type VectorSize{0};
+  size_type VectorMaxSize{N};
+  alignas(Type) unsigned char InlineBuffer[N * sizeof(Type)];
+
+  Type *InlineStore() {return reinterpret_cast<Type *>(InlineBuffer);}
+
+  const Type *InlineStore() const {
+    return reinterpret_cast<const Type *>(InlineBuffer);
+  }
+
+  void DeallocateHeap() {
+    if (!IsInline()) {
+      alloc_traits::deallocate(Alloc, Store, VectorMaxSize);
+    }
+  }
+
+  //  moves the elements to a store of NewCapacity slots, which is the
+  //  inline buffer whenever they fit in it
+
+  void Reallocate(size_type NewCapacity);
+
+  //  this is empty and inline: a heap store is taken over as it is, inline
+  //  elements are relocated into this buffer; other is left empty
+
+  void TakeElements(SmallVector &other);
+};
+
+template<typename Type, size_t N, typename Growth, typename Allocator>
+void SmallVector<Type, N, Growth, Allocator>::Reallocate(size_type NewCapacity) {
+  bool ToInline{NewCapacity <= N};
+  if (ToInline && IsInline()) {
+    return;
+  }
+  Type *store{ToInline ? InlineStore() : alloc_traits::allocate(Alloc, NewCapacity)};
+  try {
+    UninitializedRelocate(Alloc, Store, Store + VectorSize, store);
+  } catch (...) {
+    if (!ToInline) {
+      alloc_traits::deallocate(Alloc, store, NewCapacity);
+    }
+    throw;
+  }
+  DeallocateHeap();
+  Store = store;
+  VectorMaxSize = ToInline ? N : NewCapacity;
+}
+
+template<typename Type, size_t N, typename Growth, typename Allocator>
+void SmallVector<Type, N, Growth, Allocator>::TakeElements(SmallVector &other) {
+  if (other.IsInline()) {
+    UninitializedRelocate(Alloc, other.Store, other.Store + other.VectorSize, Store);
+  } else {
+    Store = other.Store;
+    VectorMaxSize = other.VectorMaxSize;
+    other.Store = other.InlineStore();
+    other.VectorMaxSize = N;
+  }
+  VectorSize = other.VectorSize;
+  other.VectorSize = 0;
+}
+
+//  when the store is full the element is built before the reallocation,
+//  args may refer to an element that is about to move
+
+template<typename Type, size_t N, typename Growth, typename Allocator>
+template<class... Args>
+typename SmallVector<Type, N, Growth, Allocator>::reference
+SmallVector<Type, N, Growth, Allocator>::emplace_back(Args&&... args) {
+  if (VectorSize >= VectorMaxSize) {
+    value_type Emplaced(std::forward<Args>(args)...);
+    Reallocate(Growth::Next(VectorMaxSize));
+    alloc_traits::construct(Alloc, Store + VectorSize, std::move(Emplaced));
+  } else {
+    alloc_traits::construct(Alloc, Store + VectorSize,
+                            std::forward<Args>(args)...);
+  }
+  VectorSize += 1;
+  return Store[VectorSize - 1];
+}
+
+template<typename Type, size_t N, typename Growth, typename Allocator>
+template<class... Args>
+typename SmallVector<Type, N, Growth, Allocator>::iterator
+SmallVector<Type, N, Growth, Allocator>::emplace(const_iterator pos, Args&&... args) {
+  size_type InsertPosition = pos.GetPointer() - Store;
+  if (InsertPosition < VectorSize) {
+    //  built aside first: args may refer to an element that is shifted
+    value_type Inserted(std::forward<Args>(args)...);
+    if (VectorSize >= VectorMaxSize) {
+      Reallocate(Growth::Next(VectorMaxSize));
+    }
+    RelocateInsert(Alloc, Store + InsertPosition, Store + VectorSize,
+                   std::move(Inserted));
+    VectorSize += 1;
+  } else {
+    InsertPosition = VectorSize;
+    emplace_back(std::forward<Args>(args)...);
+  }
+  return iterator(Store + InsertPosition);
+}
+
+template<typename Type, size_t N, typename Growth, typename Allocator>
+void SmallVector<Type, N, Growth, Allocator>::erase(const_iterator position) {
+  RelocateErase(Alloc, Store + (position.GetPointer() - Store),
+                Store + VectorSize);
+  VectorSize -= 1;
+}
+
+template<typename Type, size_t N, typename Growth, typename Allocator>
+void SmallVector<Type, N, Growth, Allocator>::pop_back() {
+  if (empty()) {
+    throw std::out_of_range("Не туда воюешь!");
+  }
+  VectorSize -= 1;
+  alloc_traits::destroy(Alloc, Store + VectorSize);
+}
+
+template<typename Type, size_t N, typename Growth, typename Allocator>
+void SmallVector<Type, N, Growth, Allocator>::shrink_to_fit() {
+  if (!IsInline() && VectorSize < VectorMaxSize) {
+    Reallocate(VectorSize);
+  }
+}
+
+template<typename Type, size_t N, typename Growth, typename Allocator>
+void SmallVector<Type, N, Growth, Allocator>::reserve(size_type NewSize) {
+  if (NewSize > max_size()) {
+    throw std::length_error("Не туда воюешь!");
+  }
+  if (NewSize > VectorMaxSize) {
+    Reallocate(NewSize);
+  }
+}
+
+//  the buffer goes back to being inline, so capacity() is N again
+
+template<typename Type, size_t N, typename Growth, typename Allocator>
+void SmallVector<Type, N, Growth, Allocator>::clear() {
+  DestroyRange(Alloc, Store, Store + VectorSize);
+  DeallocateHeap();
+  Store = InlineStore();
+  VectorSize = 0;
+  VectorMaxSize = N;
+}
+
+//  a heap store changes owners only when this allocator can free it,
+//  otherwise the elements are relocated into a store of our own
+
+template<typename Type, size_t N, typename Growth, typename Allocator>
+void SmallVector<Type, N, Growth, Allocator>::operator=(SmallVector &&other) noexcept(
+    NothrowRelocate && move_assignment_steals_v<Allocator>) {
+  if (this != &other) {
+    clear();
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+      Alloc = other.Alloc;
+      TakeElements(other);
+    } else {
+      if (other.IsInline() || Alloc == other.Alloc) {
+        TakeElements(other);
+      } else {
+        reserve(other.VectorSize);
+        UninitializedRelocate(Alloc, other.Store,
+                              other.Store + other.VectorSize, Store);
+        VectorSize = other.VectorSize;
+        other.VectorSize = 0;
+      }
+    }
+  }
+}
+
+template<typename Type, size_t N, typename Growth, typename Allocator>
+void SmallVector<Type, N, Growth, Allocator>::swap(SmallVector &other) {
+  if (!IsInline() && !other.IsInline() &&
+      (alloc_traits::propagate_on_container_swap::value || Alloc == other.Alloc)) {
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      std::swap(Alloc, other.Alloc);
+    }
+    std::swap(Store, other.Store);
+    std::swap(VectorSize, other.VectorSize);
+    std::swap(VectorMaxSize, other.VectorMaxSize);
+  } else {
+    SmallVector moved(std::move(other));
+    other = std::move(*this);
+    *this = std::move(moved);
+  }
+}
+
+template<typename Type, size_t N, typename Growth, typename Allocator>
+typename SmallVector<Type, N, Growth, Allocator>::reference
+SmallVector<Type, N, Growth, Allocator>::front() {
+  if (empty()) {
+    throw std::out_of_range("Не туда воюешь!");
+  }
+  return Store[0];
+}
+
+template<typename Type, size_t N, typename Growth, typename Allocator>
+typename SmallVector<Type, N, Growth, Allocator>::reference
+SmallVector<Type, N, Growth, Allocator>::back() {
+  if (empty()) {
+    throw std::out_of_range("Не туда воюешь!");
+  }
+  return Store[VectorSize - 1];
+}
+
+template<typename Type, size_t N, typename Growth, typename Allocator>
+typename SmallVector<Type, N, Growth, Allocator>::reference
+SmallVector<Type, N, Growth, Allocator>::at(size_type pos) {
+  if (pos >= VectorSize) {
+    throw std::out_of_range("Не туда воюешь!");
+  }
+  return Store[pos];
+}
+
+namespace pmr {
+
+template<typename Type, size_t N, typename Growth = GrowthDouble>
+using SmallVector =
+    s21::SmallVector<Type, N, Growth, std::pmr::polymorphic_allocator<Type>>;
+
+}  // namespace pmr
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_SRC_SMALLVECTOR_H_
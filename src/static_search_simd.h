@@ -0,0 +1,169 @@
+#ifndef CONTAINERS_CPP_SRC_STATIC_SEARCH_SIMD_H_
+#define CONTAINERS_CPP_SRC_STATIC_SEARCH_SIMD_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define S21_SEARCH_SIMD_X86 1
+#endif
+
+namespace s21 {
+namespace simd {
+
+// SIMD descent of a StaticSearchTree whose nodes are one 64-byte line of
+// 32- or 64-bit integer keys: the rank of the needle in a node is the
+// population count of one vector compare against the whole line (2 AVX2
+// or 4 SSE compares) instead of 16 or 8 scalar ones. The instruction set
+// is chosen once at startup with CPUID; on other CPUs and architectures
+// the scalar loop is used.
+
+enum class Level { kScalar, kSse42, kAvx2 };
+
+template <class Key>
+inline constexpr bool kSearchable =
+    std::is_integral_v<Key> && !std::is_same_v<Key, bool> &&
+    (sizeof(Key) == 4 || sizeof(Key) == 8);
+
+inline Level DetectLevel() {
+#ifdef S21_SEARCH_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("popcnt")) {
+    if (__builtin_cpu_supports("avx2")) {
+      return Level::kAvx2;
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+      return Level::kSse42;
+    }
+  }
+#endif
+  return Level::kScalar;
+}
+
+// a lookup made before this is initialized reads the zero value, kScalar
+inline const Level kLevel = DetectLevel();
+
+template <class Key>
+constexpr size_t kNodeKeys = 64 / sizeof(Key);
+
+// index of the slot with the smallest key not less than key, or none;
+// nodes is the number of nodes of the tree stored at keys
+template <class Key>
+size_t DescendScalar(const Key* keys, size_t nodes, Key key, size_t none) {
+  size_t found = none;
+  size_t node = 0;
+  while (node < nodes) {
+    size_t rank = 0;
+    for (size_t i = 0; i < kNodeKeys<Key>; i++) {
+      rank += keys[node * kNodeKeys<Key> + i] < key;
+    }
+    found = rank < kNodeKeys<Key> ? node * kNodeKeys<Key> + rank : found;
+    node = node * (kNodeKeys<Key> + 1) + rank + 1;
+  }
+  return found;
+}
+
+#ifdef S21_SEARCH_SIMD_X86
+
+// the vector compares are signed, unsigned keys are moved into the signed
+// range by flipping the top bit of both sides
+
+template <class Key>
+__attribute__((target("avx2,popcnt"))) size_t DescendAvx2(const Key* keys,
+                                                          size_t nodes,
+                                                          Key key,
+                                                          size_t none) {
+  __m256i needle;
+  __m256i flip;
+  if constexpr (sizeof(Key) == 4) {
+    flip = _mm256_set1_epi32(std::is_signed_v<Key> ? 0 : INT32_MIN);
+    needle = _mm256_xor_si256(_mm256_set1_epi32(static_cast<int32_t>(key)),
+                              flip);
+  } else {
+    flip = _mm256_set1_epi64x(std::is_signed_v<Key> ? 0 : INT64_MIN);
+    needle = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<int64_t>(key)),
+                              flip);
+  }
+  size_t found = none;
+  size_t node = 0;
+  while (node < nodes) {
+    const __m256i* line =
+        reinterpret_cast<const __m256i*>(keys + node * kNodeKeys<Key>);
+    __m256i low = _mm256_xor_si256(_mm256_load_si256(line), flip);
+    __m256i high = _mm256_xor_si256(_mm256_load_si256(line + 1), flip);
+    size_t rank;
+    if constexpr (sizeof(Key) == 4) {
+      rank = __builtin_popcount(_mm256_movemask_ps(
+                 _mm256_castsi256_ps(_mm256_cmpgt_epi32(needle, low)))) +
+             __builtin_popcount(_mm256_movemask_ps(
+                 _mm256_castsi256_ps(_mm256_cmpgt_epi32(needle, high))));
+    } else {
+      rank = __builtin_popcount(_mm256_movemask_pd(
+                 _mm256_castsi256_pd(_mm256_cmpgt_epi64(needle, low)))) +
+             __builtin_popcount(_mm256_movemask_pd(
+                 _mm256_castsi256_pd(_mm256_cmpgt_epi64(needle, high))));
+    }
+    found = rank < kNodeKeys<Key> ? node * kNodeKeys<Key> + rank : found;
+    node = node * (kNodeKeys<Key> + 1) + rank + 1;
+  }
+  return found;
+}
+
+template <class Key>
+__attribute__((target("sse4.2,popcnt"))) size_t DescendSse42(const Key* keys,
+                                                             size_t nodes,
+                                                             Key key,
+                                                             size_t none) {
+  __m128i needle;
+  __m128i flip;
+  if constexpr (sizeof(Key) == 4) {
+    flip = _mm_set1_epi32(std::is_signed_v<Key> ? 0 : INT32_MIN);
+    needle = _mm_xor_si128(_mm_set1_epi32(static_cast<int32_t>(key)), flip);
+  } else {
+    flip = _mm_set1_epi64x(std::is_signed_v<Key> ? 0 : INT64_MIN);
+    needle = _mm_xor_si128(_mm_set1_epi64x(static_cast<int64_t>(key)), flip);
+  }
+  size_t found = none;
+  size_t node = 0;
+  while (node < nodes) {
+    const __m128i* line =
+        reinterpret_cast<const __m128i*>(keys + node * kNodeKeys<Key>);
+    size_t rank = 0;
+    for (int i = 0; i < 4; i++) {
+      __m128i part = _mm_xor_si128(_mm_load_si128(line + i), flip);
+      if constexpr (sizeof(Key) == 4) {
+        rank += __builtin_popcount(
+            _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(needle, part))));
+      } else {
+        rank += __builtin_popcount(
+            _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(needle, part))));
+      }
+    }
+    found = rank < kNodeKeys<Key> ? node * kNodeKeys<Key> + rank : found;
+    node = node * (kNodeKeys<Key> + 1) + rank + 1;
+  }
+  return found;
+}
+
+#endif  // S21_SEARCH_SIMD_X86
+
+template <class Key>
+size_t Descend(const Key* keys, size_t nodes, Key key, size_t none,
+               Level level = kLevel) {
+#ifdef S21_SEARCH_SIMD_X86
+  if (level == Level::kAvx2) {
+    return DescendAvx2(keys, nodes, key, none);
+  }
+  if (level == Level::kSse42) {
+    return DescendSse42(keys, nodes, key, none);
+  }
+#endif
+  return DescendScalar(keys, nodes, key, none);
+}
+
+}  // namespace simd
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_SRC_STATIC_SEARCH_SIMD_H_
@@ -0,0 +1,236 @@
+#ifndef CONTAINERS_CPP_SRC_STATIC_SEARCH_TREE_H_
+#define CONTAINERS_CPP_SRC_STATIC_SEARCH_TREE_H_
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "static_search_simd.h"
+
+namespace s21 {
+
+// Read-only index over a sorted sequence of unique keys, laid out as an
+// implicit static B-tree: node k holds NodeKeys sorted keys and its
+// NodeKeys + 1 children are the nodes k * (NodeKeys + 1) + 1 and on, so
+// there are no child pointers. For small arithmetic keys a node is one
+// aligned cache line and a lookup reads one line per level (5 levels for
+// 1M int keys) instead of chasing ~20 dependent nodes of a binary tree.
+// Keys and payloads live in separate arrays at the same positions, the
+// search touches only the keys. Slots past the last key are padded with
+// copies of the largest key and a default Payload. For 32- and 64-bit
+// integer keys the nodes are searched with SIMD compares
+// (static_search_simd.h).
+template <class Key, class Payload,
+          class Allocator = std::allocator<Key>>
+class StaticSearchTree {
+ public:
+  typedef Key key_type;
+  typedef Payload payload_type;
+  typedef size_t size_type;
+  typedef Allocator allocator_type;
+
+  static constexpr size_type NodeKeys =
+      std::is_arithmetic_v<Key> && sizeof(Key) <= 16 ? 64 / sizeof(Key) : 16;
+
+  StaticSearchTree() {}
+
+  explicit StaticSearchTree(const allocator_type& alloc) : _alloc(alloc) {}
+
+  StaticSearchTree(const StaticSearchTree& other) = delete;
+
+  StaticSearchTree(StaticSearchTree&& other) noexcept
+      : _alloc(other._alloc) {
+    _SwapArrays(other);
+  }
+
+  ~StaticSearchTree() { Clear(); }
+
+  StaticSearchTree& operator=(const StaticSearchTree& other) = delete;
+
+  size_type Size() const { return _size; }
+
+  // sorted[0, count) must be ordered by strictly increasing key_of(payload)
+  template <class KeyOf>
+  void Build(const payload_type* sorted, size_type count, KeyOf key_of);
+
+  // payload stored with key, payload_type() when there is no such key
+  payload_type Find(const key_type& key) const;
+
+  void Clear();
+
+  void Swap(StaticSearchTree& other) {
+    if constexpr (std::allocator_traits<
+                      Allocator>::propagate_on_container_swap::value) {
+      std::swap(_alloc, other._alloc);
+    }
+    _SwapArrays(other);
+  }
+
+ private:
+  struct alignas(64) CacheLine {
+    unsigned char _bytes[64];
+  };
+
+  typedef typename std::allocator_traits<Allocator>::template rebind_alloc<
+      CacheLine>
+      line_allocator;
+  typedef std::allocator_traits<line_allocator> line_traits;
+  typedef typename std::allocator_traits<Allocator>::template rebind_alloc<
+      Key>
+      key_allocator;
+  typedef std::allocator_traits<key_allocator> key_traits;
+  typedef typename std::allocator_traits<Allocator>::template rebind_alloc<
+      Payload>
+      payload_allocator;
+  typedef std::allocator_traits<payload_allocator> payload_traits;
+
+  static_assert(alignof(Key) <= alignof(CacheLine));
+
+  Allocator _alloc;
+  Key* _keys = nullptr;
+  Payload* _payloads = nullptr;
+  size_type _nodes = 0;
+  size_type _slots = 0;
+  size_type _size = 0;
+
+  static size_type _Child(size_type node, size_type rank) {
+    return node * (NodeKeys + 1) + rank + 1;
+  }
+
+  static size_type _Lines(size_type nodes) {
+    return (nodes * NodeKeys * sizeof(Key) + sizeof(CacheLine) - 1) /
+           sizeof(CacheLine);
+  }
+
+  // number of keys of the node less than key; no early exit, so the loop
+  // has no data-dependent branches and vectorizes for arithmetic keys
+  static size_type _Rank(const Key* keys, const key_type& key) {
+    size_type rank = 0;
+    for (size_type i = 0; i < NodeKeys; i++) {
+      rank += keys[i] < key;
+    }
+    return rank;
+  }
+
+  template <class KeyOf>
+  void _Fill(size_type node, const payload_type*& sorted,
+             const payload_type* last, KeyOf& key_of);
+
+  void _SwapArrays(StaticSearchTree& other) {
+    std::swap(_keys, other._keys);
+    std::swap(_payloads, other._payloads);
+    std::swap(_nodes, other._nodes);
+    std::swap(_slots, other._slots);
+    std::swap(_size, other._size);
+  }
+};
+
+}  // namespace s21
+
+// every slot is first filled with the largest key, so a throwing copy
+// leaves only constructed keys behind for Clear; the in-order walk over
+// the implicit tree then assigns the sorted keys to their slots
+template <class Key, class Payload, class Allocator>
+template <class KeyOf>
+void s21::StaticSearchTree<Key, Payload, Allocator>::Build(
+    const payload_type* sorted, size_type count, KeyOf key_of) {
+  Clear();
+  if (count == 0) {
+    return;
+  }
+  line_allocator lines(_alloc);
+  key_allocator keys(_alloc);
+  payload_allocator payloads(_alloc);
+  size_type nodes = (count + NodeKeys - 1) / NodeKeys;
+  _keys = reinterpret_cast<Key*>(line_traits::allocate(lines, _Lines(nodes)));
+  _nodes = nodes;
+  try {
+    _payloads = payload_traits::allocate(payloads, nodes * NodeKeys);
+  } catch (...) {
+    Clear();
+    throw;
+  }
+  for (size_type i = 0; i < nodes * NodeKeys; i++) {
+    payload_traits::construct(payloads, _payloads + i);
+  }
+  try {
+    for (; _slots < nodes * NodeKeys; _slots++) {
+      key_traits::construct(keys, _keys + _slots, key_of(sorted[count - 1]));
+    }
+    _Fill(0, sorted, sorted + count, key_of);
+  } catch (...) {
+    Clear();
+    throw;
+  }
+  _size = count;
+}
+
+template <class Key, class Payload, class Allocator>
+template <class KeyOf>
+void s21::StaticSearchTree<Key, Payload, Allocator>::_Fill(
+    size_type node, const payload_type*& sorted, const payload_type* last,
+    KeyOf& key_of) {
+  if (node >= _nodes) {
+    return;
+  }
+  for (size_type i = 0; i < NodeKeys; i++) {
+    _Fill(_Child(node, i), sorted, last, key_of);
+    if (sorted != last) {
+      _keys[node * NodeKeys + i] = key_of(*sorted);
+      _payloads[node * NodeKeys + i] = *sorted;
+      ++sorted;
+    }
+  }
+  _Fill(_Child(node, NodeKeys), sorted, last, key_of);
+}
+
+// descends to the child after the keys less than key and remembers the
+// last slot holding a key not less than key, which ends as the lower bound
+template <class Key, class Payload, class Allocator>
+typename s21::StaticSearchTree<Key, Payload, Allocator>::payload_type
+s21::StaticSearchTree<Key, Payload, Allocator>::Find(
+    const key_type& key) const {
+  size_type found = _slots;
+  if constexpr (simd::kSearchable<Key> && NodeKeys == simd::kNodeKeys<Key>) {
+    found = simd::Descend(_keys, _nodes, key, _slots);
+  } else {
+    size_type node = 0;
+    while (node < _nodes) {
+      size_type rank = _Rank(_keys + node * NodeKeys, key);
+      found = rank < NodeKeys ? node * NodeKeys + rank : found;
+      node = _Child(node, rank);
+    }
+  }
+  if (found == _slots || key < _keys[found]) {
+    return payload_type();
+  }
+  return _payloads[found];
+}
+
+template <class Key, class Payload, class Allocator>
+void s21::StaticSearchTree<Key, Payload, Allocator>::Clear() {
+  key_allocator keys(_alloc);
+  for (size_type i = 0; i < _slots; i++) {
+    key_traits::destroy(keys, _keys + i);
+  }
+  if (_payloads != nullptr) {
+    payload_allocator payloads(_alloc);
+    for (size_type i = 0; i < _nodes * NodeKeys; i++) {
+      payload_traits::destroy(payloads, _payloads + i);
+    }
+    payload_traits::deallocate(payloads, _payloads, _nodes * NodeKeys);
+  }
+  if (_keys != nullptr) {
+    line_allocator lines(_alloc);
+    line_traits::deallocate(lines, reinterpret_cast<CacheLine*>(_keys),
+                            _Lines(_nodes));
+  }
+  _keys = nullptr;
+  _payloads = nullptr;
+  _nodes = 0;
+  _slots = 0;
+  _size = 0;
+}
+
+#endif  // CONTAINERS_CPP_SRC_STATIC_SEARCH_TREE_H_
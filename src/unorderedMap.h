@@ -0,0 +1,727 @@
+#ifndef CONTAINERS_CPP_SRC_UNORDEREDMAP_H_
+#define CONTAINERS_CPP_SRC_UNORDEREDMAP_H_
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "relocate.h"
+
+namespace s21 {
+
+//  UnorderedMap is an open-addressing hash table in the Swiss table style.
+//  Every slot has a control byte next to the others in a separate array:
+//
+//    Control: [ 0x13 | Empty | 0x42 | Deleted | ... | Sentinel ]
+//    Slots:   [ {k,v}|       | {k,v}|         | ... ]
+//
+//  a full slot keeps the low 7 bits of its key hash (H2), the rest of the
+//  hash (H1) picks the first group of Group::Width slots to probe. A lookup
+//  compares H2 with the 16 control bytes of a group at once (one SSE2
+//  compare, a scalar loop elsewhere) and only reads the slots whose byte
+//  matches, then goes on to the next group of a triangular probe sequence
+//  until it meets a group with an empty slot. At most 7/8 of the slots are
+//  in use, erased slots become tombstones unless their group has an empty
+//  slot, and the table is rehashed when the free ones run out.
+//  Elements move on rehash, so unlike s21::Map iterators and references
+//  are invalidated by inserts
+
+namespace hash_table {
+
+typedef int8_t control_type;
+
+constexpr control_type Empty{-128};
+constexpr control_type Deleted{-2};
+constexpr control_type Sentinel{-1};
+
+//  a group of control bytes, probed as a whole; bit i of a mask stands for
+//  the i-th byte of the group
+
+struct alignas(16) Group {
+  static constexpr size_t Width{16};
+
+  control_type Bytes[Width];
+
+#ifdef __SSE2__
+  static uint32_t Match(const control_type *group, control_type byte) {
+    __m128i Bytes{_mm_load_si128(reinterpret_cast<const __m128i *>(group))};
+    return static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(byte), Bytes)));
+  }
+
+  //  Empty and Deleted are the only bytes less than Sentinel
+
+  static uint32_t MatchFree(const control_type *group) {
+    __m128i Bytes{_mm_load_si128(reinterpret_cast<const __m128i *>(group))};
+    return static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(Sentinel), Bytes)));
+  }
+#else
+  static uint32_t Match(const control_type *group, control_type byte) {
+    uint32_t mask{0};
+    for (size_t i{0}; i < Width; i++) {
+      mask |= static_cast<uint32_t>(group[i] == byte) << i;
+    }
+    return mask;
+  }
+
+  static uint32_t MatchFree(const control_type *group) {
+    uint32_t mask{0};
+    for (size_t i{0}; i < Width; i++) {
+      mask |= static_cast<uint32_t>(group[i] < Sentinel) << i;
+    }
+    return mask;
+  }
+#endif
+};
+
+//  control bytes of a table without slots: lookups see a group with empty
+//  slots and stop, iteration meets the sentinel at once
+
+alignas(Group) inline const control_type EmptyGroup[Group::Width]{
+    Sentinel, Empty, Empty, Empty, Empty, Empty, Empty, Empty,
+    Empty,    Empty, Empty, Empty, Empty, Empty, Empty, Empty};
+
+//  std::hash of an integer is the integer itself: the product spreads it
+//  over the upper bits and the fold brings them down to H1 and H2
+
+inline uint64_t Mix(uint64_t hash) {
+  hash *= 0x9E3779B97F4A7C15ull;
+  return hash ^ (hash >> 32);
+}
+
+//  a slot is seen as pair<const Key, T> from outside and as pair<Key, T>
+//  by a rehash, which moves the key out of it the way absl's map slots do.
+//  That needs both pairs laid out alike, otherwise the key is copied
+
+template <typename Key, typename T>
+union Slot {
+  Slot() {}
+  ~Slot() {}
+
+  static constexpr bool KeyMovable{
+      std::is_standard_layout_v<std::pair<const Key, T>> &&
+      std::is_standard_layout_v<std::pair<Key, T>> &&
+      sizeof(std::pair<const Key, T>) == sizeof(std::pair<Key, T>)};
+
+  std::pair<Key, T> &Mutable() {return *std::launder(&MutableValue);}
+
+  std::pair<const Key, T> Value;
+  std::pair<Key, T> MutableValue;
+};
+
+}  // namespace hash_table
+
+template <typename Value, typename SlotType>
+class UnorderedMapIterator {
+ public:
+  typedef std::forward_iterator_tag iterator_category;
+  typedef std::remove_cv_t<Value> value_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Value *pointer;
+  typedef Value &reference;
+
+  UnorderedMapIterator() {}
+
+  UnorderedMapIterator(const hash_table::control_type *InitControl,
+                       SlotType *InitSlot)
+      : Control(InitControl), Slot(InitSlot) {
+    SkipFree();
+  }
+
+  template <typename OtherValue, typename OtherSlot>
+    requires std::is_convertible_v<OtherSlot *, SlotType *>
+  UnorderedMapIterator(
+      const UnorderedMapIterator<OtherValue, OtherSlot> &other)
+      : Control(other.GetControl()), Slot(other.GetSlot()) {}
+
+  reference operator*() const {return Slot->Value;}
+
+  pointer operator->() const {return &Slot->Value;}
+
+  UnorderedMapIterator &operator++() {
+    ++Control;
+    ++Slot;
+    SkipFree();
+    return *this;
+  }
+
+  UnorderedMapIterator operator++(int) {
+    UnorderedMapIterator old(*this);
+    ++*this;
+    return old;
+  }
+
+  bool operator==(const UnorderedMapIterator &other) const {
+    return Control == other.Control;
+  }
+
+  const hash_table::control_type *GetControl() const {return Control;}
+
+  SlotType *GetSlot() const {return Slot;}
+
+ private:
+  const hash_table::control_type *Control{nullptr};
+  SlotType *Slot{nullptr};
+
+  //  stops at a full slot or at the sentinel after the last one
+
+  void SkipFree() {
+    while (*Control < hash_table::Sentinel) {
+      ++Control;
+      ++Slot;
+    }
+  }
+};
+
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class UnorderedMap {
+ public:
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef std::pair<const Key, T> value_type;
+  typedef value_type &reference;
+  typedef const value_type &const_reference;
+  typedef size_t size_type;
+  typedef Hash hasher;
+  typedef KeyEqual key_equal;
+  typedef Allocator allocator_type;
+  typedef hash_table::Slot<Key, T> slot_type;
+  typedef UnorderedMapIterator<value_type, slot_type> iterator;
+  typedef UnorderedMapIterator<const value_type, const slot_type>
+      const_iterator;
+  typedef std::pair<iterator, bool> isInserted;
+
+  UnorderedMap() {}
+
+  explicit UnorderedMap(const Allocator &alloc)
+      : Alloc(alloc), GroupAlloc(alloc), SlotAlloc(alloc) {}
+
+  //  with room for count elements, for functors that have no default
+
+  explicit UnorderedMap(size_type count, const Hash &hash = Hash(),
+                        const KeyEqual &equal = KeyEqual(),
+                        const Allocator &alloc = Allocator())
+      : Alloc(alloc),
+        GroupAlloc(alloc),
+        SlotAlloc(alloc),
+        Hasher(hash),
+        Equal(equal) {
+    reserve(count);
+  }
+
+  UnorderedMap(std::initializer_list<value_type> const &items,
+               const Allocator &alloc = Allocator())
+      : Alloc(alloc), GroupAlloc(alloc), SlotAlloc(alloc) {
+    reserve(items.size());
+    for (auto iter{items.begin()}; iter != items.end(); iter++) {
+      insert(*iter);
+    }
+  }
+
+  UnorderedMap(const UnorderedMap &other)
+      : Alloc(alloc_traits::select_on_container_copy_construction(other.Alloc)),
+        GroupAlloc(Alloc),
+        SlotAlloc(Alloc),
+        Hasher(other.Hasher),
+        Equal(other.Equal) {
+    //  a copy that throws frees what it has built, no destructor runs
+
+    try {
+      reserve(other.Size);
+      for (auto iter{other.begin()}; iter != other.end(); ++iter) {
+        insert(*iter);
+      }
+    } catch (...) {
+      clear();
+      ReleaseStore();
+      throw;
+    }
+  }
+
+  UnorderedMap(UnorderedMap &&other) noexcept(
+      std::is_nothrow_copy_constructible_v<Hash> &&
+      std::is_nothrow_copy_constructible_v<KeyEqual>)
+      : Alloc(other.Alloc),
+        GroupAlloc(other.GroupAlloc),
+        SlotAlloc(other.SlotAlloc),
+        Hasher(other.Hasher),
+        Equal(other.Equal) {
+    SwapStore(other);
+  }
+
+  ~UnorderedMap() {
+    clear();
+    ReleaseStore();
+  }
+
+  void operator=(UnorderedMap &&other) noexcept(
+      move_assignment_steals_v<Allocator> &&
+      std::is_nothrow_copy_assignable_v<Hash> &&
+      std::is_nothrow_copy_assignable_v<KeyEqual>);
+
+  //  lookup
+
+  iterator find(const key_type &key) {
+    size_type Index{FindIndex(key)};
+    return Index == Capacity ? end() : iterator(Control + Index, Slots + Index);
+  }
+
+  const_iterator find(const key_type &key) const {
+    size_type Index{FindIndex(key)};
+    return Index == Capacity ? end()
+                             : const_iterator(Control + Index, Slots + Index);
+  }
+
+  bool contains(const key_type &key) const {
+    return FindIndex(key) != Capacity;
+  }
+
+  mapped_type &at(const key_type &key) {
+    size_type Index{FindIndex(key)};
+    if (Index == Capacity) {
+      throw std::out_of_range("No such element");
+    }
+    return Slots[Index].Value.second;
+  }
+
+  mapped_type &operator[](const key_type &key) {
+    return try_emplace(key).first->second;
+  }
+
+  //  modifiers, second of the result tells whether an element was added
+
+  template <class... Args>
+  isInserted try_emplace(const key_type &key, Args&&... args);
+
+  isInserted insert(const value_type &value) {
+    return try_emplace(value.first, value.second);
+  }
+
+  isInserted insert(const Key &key, const T &obj) {
+    return try_emplace(key, obj);
+  }
+
+  isInserted insert_or_assign(const value_type &value) {
+    isInserted result{try_emplace(value.first, value.second)};
+    if (!result.second) {
+      result.first->second = value.second;
+    }
+    return result;
+  }
+
+  void erase(iterator position) {
+    EraseIndex(static_cast<size_type>(position.GetControl() - Control));
+  }
+
+  size_type erase(const key_type &key) {
+    size_type Index{FindIndex(key)};
+    if (Index == Capacity) {
+      return 0;
+    }
+    EraseIndex(Index);
+    return 1;
+  }
+
+  void clear();
+
+  void swap(UnorderedMap &other);
+
+  //  capacity
+
+  bool empty() const {return Size == 0;}
+
+  size_type size() const {return Size;}
+
+  size_type bucket_count() const {return Capacity;}
+
+  float load_factor() const {
+    return Capacity == 0 ? 0.0f : static_cast<float>(Size) / Capacity;
+  }
+
+  //  makes room for count elements without a rehash
+
+  void reserve(size_type count);
+
+  iterator begin() {return iterator(Control, Slots);}
+
+  iterator end() {return iterator(Control + Capacity, Slots + Capacity);}
+
+  const_iterator begin() const {return const_iterator(Control, Slots);}
+
+  const_iterator end() const {
+    return const_iterator(Control + Capacity, Slots + Capacity);
+  }
+
+  allocator_type get_allocator() const {return Alloc;}
+
+ private:
+  typedef std::allocator_traits<Allocator> alloc_traits;
+  typedef typename alloc_traits::template rebind_alloc<hash_table::Group>
+      group_allocator;
+  typedef std::allocator_traits<group_allocator> group_traits;
+  typedef typename alloc_traits::template rebind_alloc<slot_type>
+      slot_allocator;
+  typedef std::allocator_traits<slot_allocator> slot_traits;
+  typedef hash_table::Group Group;
+
+  static constexpr size_type MinCapacity{Group::Width};
+
+  Allocator Alloc;
+  group_allocator GroupAlloc;
+  slot_allocator SlotAlloc;
+  [[no_unique_address]] Hash Hasher;
+  [[no_unique_address]] KeyEqual Equal;
+  hash_table::control_type *Control{
+      const_cast<hash_table::control_type *>(hash_table::EmptyGroup)};
+  slot_type *Slots{nullptr};
+  size_type Size{0};
+  size_type Capacity{0};
+  //  slots that may still be filled before the table is rehashed
+  size_type GrowthLeft{0};
+
+  static size_type MaxLoad(size_type capacity) {
+    return capacity - capacity / 8;
+  }
+
+  static hash_table::control_type H2(uint64_t hash) {
+    return static_cast<hash_table::control_type>(hash & 0x7F);
+  }
+
+  static size_type GroupMask(size_type capacity) {
+    return capacity == 0 ? 0 : capacity / Group::Width - 1;
+  }
+
+  size_type GroupMask() const {return GroupMask(Capacity);}
+
+  uint64_t HashOf(const key_type &key) const {
+    return hash_table::Mix(static_cast<uint64_t>(Hasher(key)));
+  }
+
+  //  index of the slot holding key, Capacity when there is none
+
+  size_type FindIndex(const key_type &key) const {
+    return FindIndex(key, HashOf(key));
+  }
+
+  size_type FindIndex(const key_type &key, uint64_t hash) const {
+    size_type Mask{GroupMask()};
+    size_type GroupIndex{(hash >> 7) & Mask};
+    for (size_type step{1};; step++) {
+      const hash_table::control_type *group{Control +
+                                            GroupIndex * Group::Width};
+      for (uint32_t match{Group::Match(group, H2(hash))}; match != 0;
+           match &= match - 1) {
+        size_type Index{GroupIndex * Group::Width +
+                        std::countr_zero(match)};
+        if (Equal(Slots[Index].Value.first, key)) {
+          return Index;
+        }
+      }
+      if (Group::Match(group, hash_table::Empty) != 0) {
+        return Capacity;
+      }
+      GroupIndex = (GroupIndex + step) & Mask;
+    }
+  }
+
+  //  first empty or deleted slot on the probe sequence of hash, in this
+  //  table or in the control bytes a rehash is filling
+
+  size_type FindFree(uint64_t hash) const {
+    return FindFree(Control, Capacity, hash);
+  }
+
+  static size_type FindFree(const hash_table::control_type *control,
+                            size_type capacity, uint64_t hash) {
+    size_type Mask{GroupMask(capacity)};
+    size_type GroupIndex{(hash >> 7) & Mask};
+    for (size_type step{1};; step++) {
+      uint32_t free{Group::MatchFree(control + GroupIndex * Group::Width)};
+      if (free != 0) {
+        return GroupIndex * Group::Width + std::countr_zero(free);
+      }
+      GroupIndex = (GroupIndex + step) & Mask;
+    }
+  }
+
+  void EraseIndex(size_type Index);
+
+  void Rehash(size_type NewCapacity);
+
+  void ReleaseStore();
+
+  void SwapStore(UnorderedMap &other) {
+    std::swap(Control, other.Control);
+    std::swap(Slots, other.Slots);
+    std::swap(Size, other.Size);
+    std::swap(Capacity, other.Capacity);
+    std::swap(GrowthLeft, other.GrowthLeft);
+  }
+};
+
+//  the element is built in its slot only after the table has room, so a
+//  key or argument referring into the table stays valid through a rehash
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+template <class... Args>
+typename UnorderedMap<Key, T, Hash, KeyEqual, Allocator>::isInserted
+UnorderedMap<Key, T, Hash, KeyEqual, Allocator>::try_emplace(
+    const key_type &key, Args&&... args) {
+  uint64_t hash{HashOf(key)};
+  size_type Index{FindIndex(key, hash)};
+  if (Index != Capacity) {
+    return isInserted(iterator(Control + Index, Slots + Index), false);
+  }
+  Index = FindFree(hash);
+  if (GrowthLeft == 0 && Control[Index] == hash_table::Empty) {
+    std::pair<Key, T> Emplaced(
+        std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+    //  a table mostly of tombstones is cleaned at the same capacity
+    Rehash(Capacity == 0 ? MinCapacity
+           : Size <= MaxLoad(Capacity) / 2 ? Capacity
+                                           : Capacity * 2);
+    Index = FindFree(hash);
+    alloc_traits::construct(Alloc, &Slots[Index].Value, std::move(Emplaced));
+  } else {
+    alloc_traits::construct(Alloc, &Slots[Index].Value,
+                            std::piecewise_construct,
+                            std::forward_as_tuple(key),
+                            std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+  if (Control[Index] == hash_table::Empty) {
+    GrowthLeft -= 1;
+  }
+  Control[Index] = H2(hash);
+  Size += 1;
+  return isInserted(iterator(Control + Index, Slots + Index), true);
+}
+
+//  a probe sequence only passes a group that has no empty slot, so a slot
+//  of a group with an empty one can become empty again instead of a
+//  tombstone
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void UnorderedMap<Key, T, Hash, KeyEqual, Allocator>::EraseIndex(
+    size_type Index) {
+  alloc_traits::destroy(Alloc, &Slots[Index].Value);
+  const hash_table::control_type *group{
+      Control + Index / Group::Width * Group::Width};
+  if (Group::Match(group, hash_table::Empty) != 0) {
+    Control[Index] = hash_table::Empty;
+    GrowthLeft += 1;
+  } else {
+    Control[Index] = hash_table::Deleted;
+  }
+  Size -= 1;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void UnorderedMap<Key, T, Hash, KeyEqual, Allocator>::clear() {
+  for (size_type i{0}; i < Capacity; i++) {
+    if (Control[i] >= 0) {
+      alloc_traits::destroy(Alloc, &Slots[i].Value);
+    }
+  }
+  if (Capacity != 0) {
+    std::memset(Control, hash_table::Empty, Capacity);
+  }
+  Size = 0;
+  GrowthLeft = MaxLoad(Capacity);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void UnorderedMap<Key, T, Hash, KeyEqual, Allocator>::reserve(
+    size_type count) {
+  size_type NewCapacity{MinCapacity};
+  while (MaxLoad(NewCapacity) < count) {
+    NewCapacity <<= 1;
+  }
+  if (NewCapacity > Capacity) {
+    Rehash(NewCapacity);
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void UnorderedMap<Key, T, Hash, KeyEqual, Allocator>::swap(
+    UnorderedMap &other) {
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    std::swap(Alloc, other.Alloc);
+    std::swap(GroupAlloc, other.GroupAlloc);
+    std::swap(SlotAlloc, other.SlotAlloc);
+  }
+  std::swap(Hasher, other.Hasher);
+  std::swap(Equal, other.Equal);
+  SwapStore(other);
+}
+
+//  the store can be taken over only when this allocator is able to free
+//  it, otherwise the elements are moved one by one into a store of our own
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void UnorderedMap<Key, T, Hash, KeyEqual, Allocator>::operator=(
+    UnorderedMap &&other) noexcept(move_assignment_steals_v<Allocator> &&
+                                   std::is_nothrow_copy_assignable_v<Hash> &&
+                                   std::is_nothrow_copy_assignable_v<KeyEqual>) {
+  if (this == &other) {
+    return;
+  }
+  Hasher = other.Hasher;
+  Equal = other.Equal;
+  if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+    UnorderedMap moved(std::move(other));
+    SwapStore(moved);
+    std::swap(Alloc, moved.Alloc);
+    std::swap(GroupAlloc, moved.GroupAlloc);
+    std::swap(SlotAlloc, moved.SlotAlloc);
+  } else if (Alloc == other.Alloc) {
+    UnorderedMap moved(std::move(other));
+    SwapStore(moved);
+  } else {
+    //  placed by the functors this map now holds
+
+    clear();
+    reserve(other.Size);
+    for (auto iter{other.begin()}; iter != other.end(); ++iter) {
+      try_emplace(iter->first, std::move(iter->second));
+    }
+    other.clear();
+  }
+}
+
+//  the control array holds Capacity bytes, the sentinel and the padding to
+//  a whole group. Trivially relocatable pairs are copied bytewise, others
+//  are moved only if that cannot throw; the new arrays stay with the guard
+//  until the last pair is in, so a failed rehash frees them and leaves the
+//  table as it was
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void UnorderedMap<Key, T, Hash, KeyEqual, Allocator>::Rehash(
+    size_type NewCapacity) {
+  struct NewStore {
+    UnorderedMap &Map;
+    size_type Capacity;
+    hash_table::control_type *Control{nullptr};
+    slot_type *Slots{nullptr};
+
+    ~NewStore() {
+      if (Slots != nullptr) {
+        //  bytewise copies still belong to the old slots
+
+        if constexpr (!is_trivially_relocatable_v<value_type>) {
+          for (size_type i{0}; i < Capacity; i++) {
+            if (Control[i] >= 0) {
+              alloc_traits::destroy(Map.Alloc, &Slots[i].Value);
+            }
+          }
+        }
+        slot_traits::deallocate(Map.SlotAlloc, Slots, Capacity);
+      }
+      if (Control != nullptr) {
+        group_traits::deallocate(Map.GroupAlloc,
+                                 reinterpret_cast<Group *>(Control),
+                                 Capacity / Group::Width + 1);
+      }
+    }
+  };
+
+  size_type Groups{NewCapacity / Group::Width + 1};
+  NewStore Built{*this, NewCapacity};
+  Built.Control = reinterpret_cast<hash_table::control_type *>(
+      group_traits::allocate(GroupAlloc, Groups));
+  std::memset(Built.Control, hash_table::Empty, Groups * Group::Width);
+  Built.Control[NewCapacity] = hash_table::Sentinel;
+  Built.Slots = slot_traits::allocate(SlotAlloc, NewCapacity);
+
+  for (size_type i{0}; i < Capacity; i++) {
+    if (Control[i] >= 0) {
+      uint64_t hash{HashOf(Slots[i].Value.first)};
+      size_type Index{FindFree(Built.Control, NewCapacity, hash)};
+      if constexpr (is_trivially_relocatable_v<value_type>) {
+        std::memcpy(static_cast<void *>(Built.Slots + Index),
+                    static_cast<void *>(Slots + i), sizeof(slot_type));
+      } else if constexpr (slot_type::KeyMovable) {
+        alloc_traits::construct(Alloc, &Built.Slots[Index].Value,
+                                std::move_if_noexcept(Slots[i].Mutable()));
+      } else {
+        alloc_traits::construct(Alloc, &Built.Slots[Index].Value,
+                                std::move_if_noexcept(Slots[i].Value));
+      }
+      Built.Control[Index] = H2(hash);
+    }
+  }
+
+  if constexpr (!is_trivially_relocatable_v<value_type>) {
+    for (size_type i{0}; i < Capacity; i++) {
+      if (Control[i] >= 0) {
+        alloc_traits::destroy(Alloc, &Slots[i].Value);
+      }
+    }
+  }
+  ReleaseStore();
+  Control = std::exchange(Built.Control, nullptr);
+  Slots = std::exchange(Built.Slots, nullptr);
+  Capacity = NewCapacity;
+  GrowthLeft = MaxLoad(NewCapacity) - Size;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+void UnorderedMap<Key, T, Hash, KeyEqual, Allocator>::ReleaseStore() {
+  if (Capacity != 0) {
+    group_traits::deallocate(GroupAlloc, reinterpret_cast<Group *>(Control),
+                             Capacity / Group::Width + 1);
+    slot_traits::deallocate(SlotAlloc, Slots, Capacity);
+  }
+  Control = const_cast<hash_table::control_type *>(hash_table::EmptyGroup);
+  Slots = nullptr;
+  Capacity = 0;
+  GrowthLeft = 0;
+}
+
+//  the control bytes and slots are on the heap or in the shared empty group,
+//  never inside the map
+
+template <typename Key, typename T, typename Hash, typename KeyEqual,
+          typename Allocator>
+struct is_trivially_relocatable<UnorderedMap<Key, T, Hash, KeyEqual, Allocator>>
+    : std::bool_constant<is_trivially_relocatable_v<Allocator> &&
+                         is_trivially_relocatable_v<Hash> &&
+                         is_trivially_relocatable_v<KeyEqual>> {};
+
+namespace pmr {
+
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+using UnorderedMap = s21::UnorderedMap<
+    Key, T, Hash, KeyEqual,
+    std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+
+}  // namespace pmr
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_SRC_UNORDEREDMAP_H_
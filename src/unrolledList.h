@@ -0,0 +1,650 @@
+#ifndef CONTAINERS_CPP_SRC_UNROLLEDLIST_H_
+#define CONTAINERS_CPP_SRC_UNROLLEDLIST_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "relocate.h"
+#include "vector.h"
+
+namespace s21 {
+// List with the interface of List whose nodes hold up to NodeCapacity
+// elements side by side: a node is two cache lines for small types, so a
+// scan reads mostly sequential memory and follows one link per node, and
+// the links cost 24 bytes per node instead of 16 bytes per element.
+// Inserting into a full node splits it in halves, a node that falls under
+// half full after an erase takes over its successor when both fit in one.
+// Unlike in List, insert and erase move the elements that follow them in
+// their node, so they invalidate iterators into that node (and into the
+// next one when it is split off or taken over)
+template <typename T, typename Allocator = std::allocator<T>>
+class UnrolledList {
+ public:
+  class UnrolledListIterator;
+
+  typedef T value_type;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef UnrolledListIterator iterator;
+  typedef const UnrolledListIterator const_iterator;
+  typedef size_t size_type;
+  typedef Allocator allocator_type;
+
+  // elements in a node of 128 bytes with the links, at least 4
+  static constexpr size_type NodeCapacity =
+      std::max<size_type>(4, (128 - 2 * sizeof(void*) - sizeof(size_type)) /
+                                 sizeof(T));
+
+ private:
+  struct NodeBase {
+    NodeBase* _next;
+    NodeBase* _prev;
+    size_type _count;
+  };
+
+  struct Node : NodeBase {
+    alignas(T) unsigned char _storage[NodeCapacity * sizeof(T)];
+  };
+
+  typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Node>
+      node_allocator;
+  typedef std::allocator_traits<node_allocator> node_traits;
+
+  // moving elements between nodes cannot throw, so erase can merge nodes
+  static constexpr bool NothrowRelocate =
+      is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>;
+
+  NodeBase _sentinel{&_sentinel, &_sentinel, 0};
+
+  size_type _size = 0;
+
+  node_allocator _alloc;
+
+  static value_type* Values(NodeBase* node) {
+    return reinterpret_cast<value_type*>(static_cast<Node*>(node)->_storage);
+  }
+
+  // links a new empty node in front of pos
+  NodeBase* AddNodeBefore(NodeBase* pos) {
+    Node* node = node_traits::allocate(_alloc, 1);
+    ::new (static_cast<void*>(node)) Node;
+    node->_count = 0;
+    node->_next = pos;
+    node->_prev = pos->_prev;
+    pos->_prev->_next = node;
+    pos->_prev = node;
+    return node;
+  }
+
+  // unlinks and frees a node whose elements are already gone
+  void RemoveNode(NodeBase* node) {
+    node->_prev->_next = node->_next;
+    node->_next->_prev = node->_prev;
+    node_traits::deallocate(_alloc, static_cast<Node*>(node), 1);
+  }
+
+  void DestroyValues(NodeBase* node) {
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      for (size_type i = 0; i < node->_count; i++) {
+        node_traits::destroy(_alloc, Values(node) + i);
+      }
+    }
+  }
+
+  // moves the elements [index, count) of node into a new node after it
+  NodeBase* Split(NodeBase* node, size_type index) {
+    NodeBase* tail = AddNodeBefore(node->_next);
+    try {
+      UninitializedRelocate(_alloc, Values(node) + index,
+                            Values(node) + node->_count, Values(tail));
+    } catch (...) {
+      RemoveNode(tail);
+      throw;
+    }
+    tail->_count = node->_count - index;
+    node->_count = index;
+    return tail;
+  }
+
+  void ResetSentinel() {
+    _sentinel._next = &_sentinel;
+    _sentinel._prev = &_sentinel;
+    _size = 0;
+  }
+
+  // takes all nodes of other, this list has to be empty
+  void Take(UnrolledList& other) {
+    if (other._size == 0) {
+      return;
+    }
+    _sentinel._next = other._sentinel._next;
+    _sentinel._prev = other._sentinel._prev;
+    _sentinel._next->_prev = &_sentinel;
+    _sentinel._prev->_next = &_sentinel;
+    _size = other._size;
+    other.ResetSentinel();
+  }
+
+  // moves the nodes [first, last) in front of pos, O(1)
+  static void Transfer(NodeBase* pos, NodeBase* first, NodeBase* last) {
+    NodeBase* tail = last->_prev;
+    first->_prev->_next = last;
+    last->_prev = first->_prev;
+    tail->_next = pos;
+    first->_prev = pos->_prev;
+    pos->_prev->_next = first;
+    pos->_prev = tail;
+  }
+
+ public:
+  UnrolledList() {}
+
+  explicit UnrolledList(const allocator_type& alloc) : _alloc(alloc) {}
+
+  // a constructor that throws frees the nodes it built, no destructor runs
+  UnrolledList(std::initializer_list<value_type> const& items) {
+    try {
+      for (const value_type& value : items) {
+        emplace(end(), value);
+      }
+    } catch (...) {
+      clear();
+      throw;
+    }
+  }
+
+  UnrolledList(UnrolledList const& other)
+      : _alloc(node_traits::select_on_container_copy_construction(
+            other._alloc)) {
+    try {
+      *this = other;
+    } catch (...) {
+      clear();
+      throw;
+    }
+  }
+
+  explicit UnrolledList(size_type size) {
+    try {
+      for (size_type i = 0; i < size; i++) {
+        push_back();
+      }
+    } catch (...) {
+      clear();
+      throw;
+    }
+  }
+
+  UnrolledList(UnrolledList&& other) noexcept : _alloc(other._alloc) {
+    Take(other);
+  }
+
+  ~UnrolledList() { clear(); }
+
+  void operator=(UnrolledList const& other) {
+    if (this == &other) {
+      return;
+    }
+    clear();
+    for (NodeBase* node = other._sentinel._next; node != &other._sentinel;
+         node = node->_next) {
+      for (size_type i = 0; i < node->_count; i++) {
+        emplace(end(), Values(node)[i]);
+      }
+    }
+  }
+
+  // the nodes change owners only when this allocator can free them,
+  // otherwise the values are moved into nodes of our own
+  void operator=(UnrolledList&& other) noexcept(
+      move_assignment_steals_v<Allocator>) {
+    if (this == &other) {
+      return;
+    }
+    clear();
+    if constexpr (node_traits::propagate_on_container_move_assignment::value) {
+      _alloc = other._alloc;
+      Take(other);
+    } else if (_alloc == other._alloc) {
+      Take(other);
+    } else {
+      for (iterator iter = other.begin(); iter != other.end(); ++iter) {
+        emplace(end(), std::move(*iter));
+      }
+      other.clear();
+    }
+  }
+
+  /// methods
+
+  iterator insert(iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  // builds one element from args in front of pos. It goes to the end of
+  // the previous node when pos is the first element of a node and there
+  // is room, a full node is split in halves
+  template <class... Args>
+  iterator emplace(iterator pos, Args&&... args);
+
+  template <class... Args>
+  reference emplace_back(Args&&... args) {
+    return *emplace(end(), std::forward<Args>(args)...);
+  }
+
+  template <class... Args>
+  reference emplace_front(Args&&... args) {
+    return *emplace(begin(), std::forward<Args>(args)...);
+  }
+
+  void erase(iterator pos);
+
+  void pop_back() {
+    if (!empty()) {
+      erase(--end());
+    }
+  }
+
+  void pop_front() {
+    if (!empty()) {
+      erase(begin());
+    }
+  }
+
+  void swap(UnrolledList& other) {
+    UnrolledList held(std::move(other));
+    other.Take(*this);
+    Take(held);
+    if constexpr (node_traits::propagate_on_container_swap::value) {
+      std::swap(_alloc, other._alloc);
+    }
+  }
+
+  // merges the sorted other into this sorted list in O(N + M), stable: of
+  // equal values the ones of this list come first. The values are moved
+  // into new nodes; if comp throws, both lists are left valid with
+  // unspecified contents
+  void merge(UnrolledList& other) { merge(other, std::less<>()); }
+
+  template <class Compare>
+  void merge(UnrolledList& other, Compare comp);
+
+  // moves all elements of other in front of pos; the node at pos is split
+  // there and the nodes of other are linked in between, O(NodeCapacity)
+  void splice(const_iterator pos, UnrolledList& other);
+
+  // moves the element at it of other in front of pos
+  void splice(const_iterator pos, UnrolledList& other, const_iterator it);
+
+  // reverses the order of the nodes and the elements inside every node
+  void reverse() {
+    NodeBase* node = &_sentinel;
+    do {
+      std::swap(node->_next, node->_prev);
+      std::reverse(Values(node), Values(node) + node->_count);
+      node = node->_prev;
+    } while (node != &_sentinel);
+  }
+
+  // removes all but the first of every run of equal adjacent values, O(N):
+  // the kept values are moved forward and the tail is erased
+  void unique() { unique(std::equal_to<>()); }
+
+  template <class BinaryPredicate>
+  void unique(BinaryPredicate equal);
+
+  // stable sort of pointers to the values in one contiguous array, the
+  // values are only moved once it has succeeded: if comp throws, the list
+  // is left as it was
+  void sort() { sort(std::less<>()); }
+
+  template <class Compare>
+  void sort(Compare comp);
+
+  void push_back() { emplace(end()); }
+
+  void push_back(value_type value) { emplace(end(), std::move(value)); }
+
+  void push_front(value_type value) { emplace(begin(), std::move(value)); }
+
+  bool empty() { return _size == 0; }
+
+  // front and back expect a non-empty list
+  reference back() {
+    return Values(_sentinel._prev)[_sentinel._prev->_count - 1];
+  }
+
+  reference front() { return Values(_sentinel._next)[0]; }
+
+  void clear() {
+    NodeBase* node = _sentinel._next;
+    while (node != &_sentinel) {
+      NodeBase* next = node->_next;
+      DestroyValues(node);
+      node_traits::deallocate(_alloc, static_cast<Node*>(node), 1);
+      node = next;
+    }
+    ResetSentinel();
+  }
+
+  size_type size() { return _size; }
+
+  size_type max_size() {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type);
+  }
+
+  allocator_type get_allocator() { return allocator_type(_alloc); }
+
+  /// iterators
+
+  class UnrolledListIterator {
+   public:
+    typedef std::bidirectional_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T* pointer;
+    typedef T& reference;
+
+    UnrolledListIterator() {}
+
+    UnrolledListIterator(NodeBase* node, size_type index)
+        : _node(node), _index(index) {}
+
+    reference operator*() const { return Values(_node)[_index]; }
+
+    pointer operator->() const { return Values(_node) + _index; }
+
+    UnrolledListIterator& operator++() {
+      if (++_index == _node->_count) {
+        _node = _node->_next;
+        _index = 0;
+      }
+      return *this;
+    }
+
+    UnrolledListIterator operator++(int) {
+      UnrolledListIterator old = *this;
+      ++*this;
+      return old;
+    }
+
+    UnrolledListIterator& operator--() {
+      if (_index == 0) {
+        _node = _node->_prev;
+        _index = _node->_count;
+      }
+      --_index;
+      return *this;
+    }
+
+    UnrolledListIterator operator--(int) {
+      UnrolledListIterator old = *this;
+      --*this;
+      return old;
+    }
+
+    // steps over whole nodes at once
+    UnrolledListIterator operator+(difference_type number) const {
+      if (number < 0) {
+        return *this - (-number);
+      }
+      UnrolledListIterator ret = *this;
+      size_type left = number;
+      while (left != 0 && ret._node->_count != 0) {
+        size_type here = ret._node->_count - ret._index;
+        if (left < here) {
+          ret._index += left;
+          left = 0;
+        } else {
+          left -= here;
+          ret._node = ret._node->_next;
+          ret._index = 0;
+        }
+      }
+      return ret;
+    }
+
+    UnrolledListIterator operator-(difference_type number) const {
+      if (number < 0) {
+        return *this + (-number);
+      }
+      UnrolledListIterator ret = *this;
+      size_type left = number;
+      while (left > ret._index && ret._node->_prev->_count != 0) {
+        left -= ret._index + 1;
+        ret._node = ret._node->_prev;
+        ret._index = ret._node->_count - 1;
+      }
+      ret._index -= std::min(left, ret._index);
+      return ret;
+    }
+
+    bool operator==(const UnrolledListIterator& other) const {
+      return _node == other._node && _index == other._index;
+    }
+
+   private:
+    friend class UnrolledList;
+
+    NodeBase* _node = nullptr;
+    size_type _index = 0;
+  };
+
+  iterator begin() { return iterator(_sentinel._next, 0); }
+
+  iterator end() { return iterator(&_sentinel, 0); }
+};
+
+template <typename T, typename Allocator>
+template <class... Args>
+typename UnrolledList<T, Allocator>::iterator
+UnrolledList<T, Allocator>::emplace(iterator pos, Args&&... args) {
+  NodeBase* node = pos._node == nullptr ? &_sentinel : pos._node;
+  size_type index = pos._index;
+  if (index == 0 && node->_prev != &_sentinel &&
+      node->_prev->_count < NodeCapacity) {
+    node = node->_prev;
+    index = node->_count;
+  } else if (node == &_sentinel ||
+             (index == 0 && node->_count == NodeCapacity)) {
+    node = AddNodeBefore(node);
+  } else if (node->_count == NodeCapacity) {
+    // the value is built before the split moves what args may refer to
+    value_type value(std::forward<Args>(args)...);
+    NodeBase* tail = Split(node, NodeCapacity / 2);
+    if (index > NodeCapacity / 2) {
+      node = tail;
+      index -= NodeCapacity / 2;
+    }
+    return emplace(iterator(node, index), std::move(value));
+  }
+  value_type* slot = Values(node) + index;
+  try {
+    if (index == node->_count) {
+      node_traits::construct(_alloc, slot, std::forward<Args>(args)...);
+    } else {
+      value_type value(std::forward<Args>(args)...);
+      RelocateInsert(_alloc, slot, Values(node) + node->_count,
+                     std::move(value));
+    }
+  } catch (...) {
+    if (node->_count == 0) {
+      RemoveNode(node);
+    }
+    throw;
+  }
+  node->_count++;
+  _size++;
+  return iterator(node, index);
+}
+
+template <typename T, typename Allocator>
+void UnrolledList<T, Allocator>::erase(iterator pos) {
+  NodeBase* node = pos._node;
+  if (node == nullptr || node == &_sentinel)
+    throw std::out_of_range("erase : iterator point to null");
+  RelocateErase(_alloc, Values(node) + pos._index,
+                Values(node) + node->_count);
+  node->_count--;
+  _size--;
+  NodeBase* next = node->_next;
+  if (node->_count == 0) {
+    RemoveNode(node);
+  } else if constexpr (NothrowRelocate) {
+    if (node->_count < NodeCapacity / 2 && next != &_sentinel &&
+        node->_count + next->_count <= NodeCapacity) {
+      UninitializedRelocate(_alloc, Values(next), Values(next) + next->_count,
+                            Values(node) + node->_count);
+      node->_count += next->_count;
+      RemoveNode(next);
+    }
+  }
+}
+
+template <typename T, typename Allocator>
+template <class Compare>
+void UnrolledList<T, Allocator>::merge(UnrolledList& other, Compare comp) {
+  if (this == &other || other._size == 0) {
+    return;
+  }
+  UnrolledList merged(get_allocator());
+  iterator left = begin(), right = other.begin();
+  while (left != end() && right != other.end()) {
+    if (comp(*right, *left)) {
+      merged.emplace(merged.end(), std::move(*right));
+      ++right;
+    } else {
+      merged.emplace(merged.end(), std::move(*left));
+      ++left;
+    }
+  }
+  for (; left != end(); ++left) {
+    merged.emplace(merged.end(), std::move(*left));
+  }
+  for (; right != other.end(); ++right) {
+    merged.emplace(merged.end(), std::move(*right));
+  }
+  clear();
+  other.clear();
+  Take(merged);
+}
+
+template <typename T, typename Allocator>
+void UnrolledList<T, Allocator>::splice(const_iterator pos,
+                                        UnrolledList& other) {
+  if (this == &other || other._size == 0) {
+    return;
+  }
+  iterator position = pos;
+  if (!(_alloc == other._alloc)) {
+    for (iterator iter = other.begin(); iter != other.end(); ++iter) {
+      position = emplace(position, std::move(*iter));
+      ++position;
+    }
+    other.clear();
+    return;
+  }
+  NodeBase* target = position._node == nullptr ? &_sentinel : position._node;
+  if (position._index != 0) {
+    target = Split(target, position._index);
+  }
+  Transfer(target, other._sentinel._next, &other._sentinel);
+  _size += other._size;
+  other.ResetSentinel();
+}
+
+// within one list the positions are counted first, since erase and insert
+// both move elements
+template <typename T, typename Allocator>
+void UnrolledList<T, Allocator>::splice(const_iterator pos,
+                                        UnrolledList& other,
+                                        const_iterator it) {
+  iterator position = pos, element = it;
+  if (this != &other) {
+    emplace(position, std::move(*element));
+    other.erase(element);
+    return;
+  }
+  if (position == element) {
+    return;
+  }
+  size_type to = 0, from = 0;
+  for (iterator iter = begin(); iter != position; ++iter) to++;
+  for (iterator iter = begin(); iter != element; ++iter) from++;
+  value_type moved(std::move(*element));
+  erase(element);
+  if (from < to) to--;
+  emplace(begin() + to, std::move(moved));
+}
+
+template <typename T, typename Allocator>
+template <class BinaryPredicate>
+void UnrolledList<T, Allocator>::unique(BinaryPredicate equal) {
+  if (_size < 2) {
+    return;
+  }
+  iterator write = begin();
+  size_type kept = 1;
+  for (iterator read = ++begin(); read != end(); ++read) {
+    if (!equal(*write, *read)) {
+      ++write;
+      if (!(write == read)) {
+        *write = std::move(*read);
+      }
+      kept++;
+    }
+  }
+  while (_size > kept) {
+    pop_back();
+  }
+}
+
+template <typename T, typename Allocator>
+template <class Compare>
+void UnrolledList<T, Allocator>::sort(Compare comp) {
+  if (_size < 2) {
+    return;
+  }
+  typedef typename std::allocator_traits<Allocator>::template rebind_alloc<
+      value_type*>
+      pointer_allocator;
+  Vector<value_type*, GrowthDouble, pointer_allocator> order(
+      (pointer_allocator(_alloc)));
+  order.reserve(_size);
+  for (iterator iter = begin(); iter != end(); ++iter) {
+    order.push_back(&*iter);
+  }
+  std::stable_sort(order.begin(), order.end(),
+                   [&comp](value_type* left, value_type* right) {
+                     return comp(*left, *right);
+                   });
+  Vector<value_type, GrowthDouble, allocator_type> values(get_allocator());
+  values.reserve(_size);
+  for (size_type i = 0; i < _size; i++) {
+    values.push_back(std::move(*order[i]));
+  }
+  size_type i = 0;
+  for (iterator iter = begin(); iter != end(); ++iter) {
+    *iter = std::move(values[i++]);
+  }
+}
+
+namespace pmr {
+template <typename T>
+using UnrolledList =
+    s21::UnrolledList<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+
+}  // namespace s21
+
+#endif  // CONTAINERS_CPP_SRC_UNROLLEDLIST_H_
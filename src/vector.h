@@ -5,121 +5,107 @@
 #ifndef CONTAINERS_CPP_SRC_VECTOR_H_
 #define CONTAINERS_CPP_SRC_VECTOR_H_
 
+#include <cstring>
 #include <iostream>
 #include <string>
+#include <limits>
 #include <memory>
+#include <memory_resource>
+#include <type_traits>
 
-namespace s21 {
-template<typename Type>
-class Vector {
- public:
-
-  class VectorIterator {
-   public:
-
-    VectorIterator() {}
-
-    VectorIterator(const VectorIterator &other) {
-      Pointer = other.Pointer;
-      Position = other.Position;
-    }
-
-    ~VectorIterator() {}
-
-    void SetIterator(std::shared_ptr<Type[]> InitPointer) {Pointer = InitPointer;}
-
-    Type &operator*() {return Pointer[Position];}
+#include "contiguousIterator.h"
+#include "relocate.h"
 
-    void operator++() {Position += 1;}
-
-    void operator--() {Position -= 1;}
-
-    void operator=(const VectorIterator other) {
-      copy(other);
-      Pointer = other.Pointer;
-    }
-
-    bool operator==(const VectorIterator other) {return Position == other.Position;}
-
-    bool operator!=(const VectorIterator other) {return Position != other.Position;}
-
-    bool operator>=(const VectorIterator other) {return Position >= other.Position;}
+namespace s21 {
 
-    bool operator<=(const VectorIterator other) {return Position <= other.Position;}
+//  Growth policy: capacity is multiplied by Numerator / Denominator every time
+//  the store is full, so a sequence of push_back costs amortized O(1)
 
-    void Advance(size_t repeat) {Position += repeat;}
+template<size_t Numerator, size_t Denominator>
+struct GrowthFactor {
+  static_assert(Numerator > Denominator, "Growth factor must be greater than 1");
 
-    void Decrease(size_t repeat) {Position -= repeat;}
+  static size_t Next(size_t Capacity) {
+    size_t Grown = Capacity * Numerator / Denominator;
+    return Grown > Capacity ? Grown : Capacity + 1;
+  }
+};
 
-    const size_t GetPosition() {return Position;}
+typedef GrowthFactor<3, 2> GrowthOneAndHalf;
+typedef GrowthFactor<2, 1> GrowthDouble;
 
-    void swap(VectorIterator &other) {
-      Pointer.swap(other.Pointer);
-      std::swap(Position, other.Position);
-    }
+//  Store is obtained from Allocator, so a Vector can live in a
+//  std::pmr::memory_resource (see s21::pmr::Vector below). Only the first
+//  VectorSize slots hold constructed elements, the rest of the capacity is
+//  raw memory: elements are built in place and destroyed explicitly
 
-    void copy(const VectorIterator other) {Position = other.Position;}
+template<typename Type, typename Growth = GrowthDouble,
+         typename Allocator = std::allocator<Type>>
+class Vector {
+ public:
 
-   private:
-    std::shared_ptr<Type[]> Pointer;
-    size_t Position{0};
-  };
+  typedef ContiguousIterator<Type> VectorIterator;
 
   typedef size_t size_type;
   typedef Type value_type;
   typedef Type &reference;
-  typedef Type &const_reference;
+  typedef const Type &const_reference;
   typedef VectorIterator iterator;
-  typedef const VectorIterator const_iterator;
+  typedef ContiguousIterator<const Type> const_iterator;
+  typedef Allocator allocator_type;
   //  Vector constructors
 
-  Vector() {
-    BeginIterator.SetIterator(Store);
-    EndIterator.SetIterator(Store);
-  }
+  Vector() {}
 
-  Vector(const size_type NewSize) {
-    Store.reset(new Type[NewSize]{});
-    VectorMaxSize = NewSize;
-    BeginIterator.SetIterator(Store);
-    EndIterator.SetIterator(Store);
+  explicit Vector(const Allocator &alloc) : Alloc(alloc) {}
+
+  Vector(const size_type NewSize, const Allocator &alloc = Allocator())
+      : Alloc(alloc) {
+    Reallocate(NewSize);
   }
 
-  Vector(const Vector &other) {
-    VectorSize = other.VectorSize;
-    VectorMaxSize = other.VectorMaxSize;
-    Store.reset(new Type[VectorMaxSize]{});
-    for (int i{0}; i < VectorSize; i++) {
-      Store[i] = other.Store[i];
+  Vector(const Vector &other)
+      : Alloc(alloc_traits::select_on_container_copy_construction(other.Alloc)) {
+    Reallocate(other.VectorMaxSize);
+    try {
+      UninitializedCopy(Alloc, other.Store, other.Store + other.VectorSize,
+                        Store);
+    } catch (...) {
+      DeallocateStore(Store, VectorMaxSize);
+      throw;
     }
-    BeginIterator.SetIterator(Store);
-    BeginIterator.copy(other.BeginIterator);
-    EndIterator.SetIterator(Store);
-    EndIterator.copy(other.EndIterator);
+    VectorSize = other.VectorSize;
   }
 
-  Vector(std::initializer_list<value_type> const &items) {
-    VectorSize = items.size();
-    VectorMaxSize = VectorSize;
-    Store.reset(new Type[VectorSize]{});
-    BeginIterator.SetIterator(Store);
-    EndIterator.SetIterator(Store);
-    auto iter{items.begin()};
-    Store[0] = *iter;
-    iter++;
-    for (int i{1}; iter != items.end(); i++, iter++) {
-      Store[i] = *iter;
-      ++EndIterator;
+  Vector(std::initializer_list<value_type> const &items,
+         const Allocator &alloc = Allocator())
+      : Alloc(alloc) {
+    Reallocate(items.size());
+    for (auto iter{items.begin()}; iter != items.end(); iter++) {
+      push_back(*iter);
     }
   }
 
-  Vector(Vector &&other) {swap(other);}
+  Vector(Vector &&other) noexcept : Alloc(other.Alloc) {SwapStore(other);}
+
+  ~Vector() {
+    DestroyRange(Alloc, Store, Store + VectorSize);
+    DeallocateStore(Store, VectorMaxSize);
+  }
 
   //  Vector methods
 
-  void push_back(value_type value);
+  void push_back(const_reference value) {emplace_back(value);}
 
-  void pop_back();
+  void push_back(value_type &&value) {emplace_back(std::move(value));}
+
+  void pop_back() {
+    if (empty()) {
+      throw std::out_of_range("Не туда воюешь!");
+    }
+    VectorSize -= 1;
+    alloc_traits::destroy(Alloc, Store + VectorSize);
+  }
 
   void shrink_to_fit();
 
@@ -127,21 +113,41 @@ class Vector {
 
   void swap(Vector& other);
 
-  const_reference front();
+  reference front() {
+    if (empty()) {
+      throw std::out_of_range("Не туда воюешь!");
+    }
+    return Store[0];
+  }
 
-  const_reference back();
+  reference back() {
+    if (empty()) {
+      throw std::out_of_range("Не туда воюешь!");
+    }
+    return Store[VectorSize - 1];
+  }
 
   reference at(size_type pos);
 
-  iterator begin() {return BeginIterator;}
+  iterator begin() {return iterator(Store);}
 
-  iterator end() {return EndIterator;}
+  iterator end() {return iterator(Store + VectorSize);}
+
+  const_iterator begin() const {return const_iterator(Store);}
+
+  const_iterator end() const {return const_iterator(Store + VectorSize);}
 
   reference operator[](size_type pos) {return Store[pos];}
 
-  iterator insert(iterator pos, const_reference value);
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
 
-  void operator=(Vector &&other );
+  void operator=(Vector &&other) noexcept(move_assignment_steals_v<Allocator>);
 
   //  capacity methods
 
@@ -155,9 +161,9 @@ class Vector {
 
   size_type size() {return VectorSize;}
 
-  size_type max_size() {return VectorMaxSize;}
+  size_type max_size() {return std::numeric_limits<size_type>::max() / sizeof(Type);}
 
-  size_type capacity() {return VectorMaxSize - VectorSize;}
+  size_type capacity() {return VectorMaxSize;}
 
   void SizeIncrement() {VectorSize++;}
 
@@ -165,206 +171,203 @@ class Vector {
 
   void clear();
 
-  void ResetPointer(std::shared_ptr<Type[]> newPointer);
+  void erase(const_iterator position);
 
-  void erase(iterator position);
+  Type *data() {return Store;}
 
-  std::shared_ptr<Type[]> data() {return Store;}
+  allocator_type get_allocator() {return Alloc;}
 
-  iterator emplace(const_iterator pos) {return pos;}
+  //  emplace and emplace_back construct one element from args, the way
+  //  std::vector does
 
-  template <class T, class... Args>
-  iterator emplace(const_iterator pos, T data, Args... args) {
-    iterator real_pos{insert(pos, data)};
-    real_pos = emplace(real_pos, args...);
-    return real_pos;
-  }
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args&&... args);
+
+  //  the common case of emplace_back is small enough to be inlined at the
+  //  call site, growing the store is left to EmplaceGrow
 
-  void emplace_back() {}
-  template <class T, class... Args>
-  void emplace_back(T data, Args... args) {
-    push_back(data);
-    emplace_back(args...);
+  template <class... Args>
+  reference emplace_back(Args&&... args) {
+    if (VectorSize >= VectorMaxSize) {
+      return EmplaceGrow(std::forward<Args>(args)...);
+    }
+    alloc_traits::construct(Alloc, Store + VectorSize,
+                            std::forward<Args>(args)...);
+    VectorSize += 1;
+    return Store[VectorSize - 1];
   }
 
  private:
-  std::shared_ptr<Type[]> Store{new Type[0]{}};
-  iterator BeginIterator;
-  iterator EndIterator;
+  typedef std::allocator_traits<Allocator> alloc_traits;
+
+  Allocator Alloc;
+  Type *Store{nullptr};
   size_type VectorSize{0};
   size_type VectorMaxSize{0};
 
-  void IncreaseStoreAllocation(const Vector &old) {
-    std::shared_ptr<Type[]> store{new Type[VectorMaxSize]{}};
-    for (size_t i{0}; i < VectorSize; i++) {
-      store[i] = old.Store[i];
+  template <class... Args>
+  reference EmplaceGrow(Args&&... args);
+
+  //  raw memory for Capacity elements, nothing is constructed
+
+  Type *AllocateStore(size_type Capacity) {
+    Type *store{nullptr};
+    if (Capacity != 0) {
+      store = alloc_traits::allocate(Alloc, Capacity);
     }
-    Store = std::move(store);
-    BeginIterator.SetIterator(Store);
-    EndIterator.SetIterator(Store);
+    return store;
   }
 
-  void DecreaseStoreAllocation(const Vector &old) {
-    std::shared_ptr<Type[]> store{new Type[VectorMaxSize]{}};
-    for (size_t i{0}; i < VectorSize; i++) {
-      store[i] = old.Store[i];
+  void DeallocateStore(Type *store, size_type Capacity) {
+    if (store != nullptr) {
+      alloc_traits::deallocate(Alloc, store, Capacity);
     }
-    Store = std::move(store);
   }
-};
 
+  //  moves to a store of NewCapacity slots keeping the first VectorSize
 
-template<typename Type>
-void Vector<Type>::push_back(value_type value) {
-  if (!empty()) {
-    ++EndIterator;
+  void Reallocate(size_type NewCapacity) {
+    Type *store{AllocateStore(NewCapacity)};
+    try {
+      UninitializedRelocate(Alloc, Store, Store + VectorSize, store);
+    } catch (...) {
+      DeallocateStore(store, NewCapacity);
+      throw;
+    }
+    DeallocateStore(Store, VectorMaxSize);
+    VectorMaxSize = NewCapacity;
+    Store = store;
   }
-  if (VectorSize >= VectorMaxSize) {
-    VectorMaxSize += 1;
-    IncreaseStoreAllocation(*this);
+
+  void SwapStore(Vector &other) {
+    std::swap(Store, other.Store);
+    std::swap(VectorSize, other.VectorSize);
+    std::swap(VectorMaxSize, other.VectorMaxSize);
   }
+};
+
+
+//  when the store is full the element is built before the reallocation,
+//  args may refer to an element that is about to move
+
+template<typename Type, typename Growth, typename Allocator>
+template<class... Args>
+typename Vector<Type, Growth, Allocator>::reference
+Vector<Type, Growth, Allocator>::EmplaceGrow(Args&&... args) {
+  value_type Emplaced(std::forward<Args>(args)...);
+  Reallocate(Growth::Next(VectorMaxSize));
+  alloc_traits::construct(Alloc, Store + VectorSize, std::move(Emplaced));
   VectorSize += 1;
-  *EndIterator = value;
+  return Store[VectorSize - 1];
 }
 
-template<typename Type>
-void Vector<Type>::shrink_to_fit() {
+template<typename Type, typename Growth, typename Allocator>
+void Vector<Type, Growth, Allocator>::shrink_to_fit() {
   if (VectorSize < VectorMaxSize) {
-    DecreaseStoreAllocation(*this);
-    VectorMaxSize = VectorSize;
+    Reallocate(VectorSize);
   }
 }
 
-template<typename Type>
-void Vector<Type>::reserve(size_type NewSize) {
-      VectorMaxSize += NewSize;
-      IncreaseStoreAllocation(*this);
-    }
-
-template<typename Type>
-void Vector<Type>::swap(Vector& other) {
-  Store.swap(other.Store);
-  std::swap(VectorSize, other.VectorSize);
-  std::swap(VectorMaxSize, other.VectorMaxSize);
-  BeginIterator.swap(other.BeginIterator);
-  EndIterator.swap(other.EndIterator);
+template<typename Type, typename Growth, typename Allocator>
+void Vector<Type, Growth, Allocator>::reserve(size_type NewSize) {
+  if (NewSize > max_size()) {
+    throw std::length_error("Не туда воюешь!");
+  }
+  if (NewSize > VectorMaxSize) {
+    Reallocate(NewSize);
+  }
 }
 
-template<typename Type>
-void Vector<Type>::clear() {
-  while (EndIterator != BeginIterator) {
-    *EndIterator = 0;
-    --EndIterator;
+template<typename Type, typename Growth, typename Allocator>
+void Vector<Type, Growth, Allocator>::swap(Vector& other) {
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    std::swap(Alloc, other.Alloc);
   }
-  VectorSize = 0;
-  VectorMaxSize = 0;
-  Store.reset(new Type[0]{});
-  EndIterator.SetIterator(Store);
-  BeginIterator.SetIterator(Store);
+  SwapStore(other);
 }
 
-template<typename Type>
-void Vector<Type>::ResetPointer(std::shared_ptr<Type[]> newPointer) {
-  Store = newPointer;
-  BeginIterator.SetIterator(Store);
-  EndIterator.SetIterator(Store);
+template<typename Type, typename Growth, typename Allocator>
+void Vector<Type, Growth, Allocator>::clear() {
+  DestroyRange(Alloc, Store, Store + VectorSize);
+  DeallocateStore(Store, VectorMaxSize);
+  VectorSize = 0;
+  VectorMaxSize = 0;
+  Store = nullptr;
 }
 
-template<typename Type>
-void Vector<Type>::erase(iterator position) {
-  *position = 0;
-  --EndIterator;
-  for (size_t i{0}, j{0}; i < VectorSize; i++, j++) {
-    if (i == position.GetPosition()) {
-      j++;
-    }
-    Store[i] = Store[j];
-  }
+template<typename Type, typename Growth, typename Allocator>
+void Vector<Type, Growth, Allocator>::erase(const_iterator position) {
+  RelocateErase(Alloc, Store + (position.GetPointer() - Store),
+                Store + VectorSize);
   VectorSize -= 1;
 }
 
-template<typename Type>
-void Vector<Type>::operator=(Vector &&other ) {
-  VectorSize = other.VectorSize;
-  VectorMaxSize = other.VectorMaxSize;
-  Store.reset(new Type[VectorMaxSize]{});
-  for (int i{0}; i < VectorSize; i++) {
-    Store[i] = other.Store[i];
+template<typename Type, typename Growth, typename Allocator>
+void Vector<Type, Growth, Allocator>::operator=(Vector &&other) noexcept(
+    move_assignment_steals_v<Allocator>) {
+  if (this != &other) {
+    clear();
+    if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+      Alloc = other.Alloc;
+      SwapStore(other);
+    } else if (Alloc == other.Alloc) {
+      SwapStore(other);
+    } else {
+      //  memory of other's allocator cannot be freed by ours: the elements
+      //  move into a store of our own
+
+      Reallocate(other.VectorSize);
+      UninitializedRelocate(Alloc, other.Store, other.Store + other.VectorSize,
+                            Store);
+      VectorSize = other.VectorSize;
+      other.VectorSize = 0;
+    }
   }
-  BeginIterator.SetIterator(Store);
-  BeginIterator.copy(other.BeginIterator);
-  EndIterator.SetIterator(Store);
-  EndIterator.copy(other.EndIterator);
 }
 
 
-template<typename Type>
-typename Vector<Type>::iterator Vector<Type>::insert(iterator pos, const_reference value) {
-size_type InsertPosition = pos.GetPosition();
-  VectorSize += 1;
-  if (VectorSize >= VectorMaxSize) {
-    VectorMaxSize += 1;
-    IncreaseStoreAllocation(*this);
-  }
-  std::shared_ptr<value_type[]> store{new value_type[VectorMaxSize]};
-  if (InsertPosition < VectorSize - 1) {
-    VectorIterator access(begin());
-    for (size_t i{0}, j{0}; i < VectorSize - 1; i++, j++) {
-    if (j == InsertPosition) {
-      store[j] = value;
-      j++;
-    }
-      store[j] = *access;
-      ++access;
+template<typename Type, typename Growth, typename Allocator>
+template<class... Args>
+typename Vector<Type, Growth, Allocator>::iterator
+Vector<Type, Growth, Allocator>::emplace(const_iterator pos, Args&&... args) {
+  size_type InsertPosition = pos.GetPointer() - Store;
+  if (InsertPosition < VectorSize) {
+    //  built aside first: args may refer to an element that is shifted
+    value_type Inserted(std::forward<Args>(args)...);
+    if (VectorSize >= VectorMaxSize) {
+      Reallocate(Growth::Next(VectorMaxSize));
     }
-    Store = std::move(store);
-    BeginIterator.SetIterator(Store);
-    EndIterator.SetIterator(Store);
+    RelocateInsert(Alloc, Store + InsertPosition, Store + VectorSize,
+                   std::move(Inserted));
+    VectorSize += 1;
   } else {
-    *EndIterator = value;
+    InsertPosition = VectorSize;
+    emplace_back(std::forward<Args>(args)...);
   }
-  ++EndIterator;
-  VectorIterator InsertedPositionIterator;
-  InsertedPositionIterator.SetIterator(Store);
-  InsertedPositionIterator.Advance(InsertPosition);
-  return InsertedPositionIterator;
+  return iterator(Store + InsertPosition);
 }
 
-template<typename Type>
-void Vector<Type>::pop_back() {
-  if (empty()) {
+template<typename Type, typename Growth, typename Allocator>
+typename Vector<Type, Growth, Allocator>::reference Vector<Type, Growth, Allocator>::at(size_type pos) {
+  if (pos >= VectorSize) {
     throw std::out_of_range("Не туда воюешь!");
   }
-  *EndIterator = 0;
-  VectorSize -= 1;
-  *EndIterator = 0;
-  --EndIterator;
+  return Store[pos];
 }
 
-template<typename Type>
-typename Vector<Type>::const_reference Vector<Type>::front() {
-  if (empty())  {
-    throw std::out_of_range("Не туда воюешь!");
-  }
-  return *BeginIterator;
-}
+//  a vector holds no pointers into itself, so it relocates with a byte copy
+//  whenever its allocator does: a Vector of Vectors regrows with memcpy
 
-template<typename Type>
-typename Vector<Type>::const_reference Vector<Type>::back() {
-  if (empty())  {
-    throw std::out_of_range("Не туда воюешь!");
-  }
-  return *EndIterator;
-}
+template<typename Type, typename Growth, typename Allocator>
+struct is_trivially_relocatable<Vector<Type, Growth, Allocator>>
+    : is_trivially_relocatable<Allocator> {};
 
-template<typename Type>
-typename Vector<Type>::reference Vector<Type>::at(size_type pos) {
-  if (pos < 0 && pos > VectorSize) {
-    throw std::out_of_range("Не туда воюешь!");
-  }
-  return Store[pos];
-}
+namespace pmr {
+
+template<typename Type, typename Growth = GrowthDouble>
+using Vector = s21::Vector<Type, Growth, std::pmr::polymorphic_allocator<Type>>;
 
+}  // namespace pmr
 
 }
 